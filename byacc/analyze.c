@@ -0,0 +1,225 @@
+#include "defs.h"
+
+/*  The relations of the grammar that the construction of the parser    */
+/*  needs are computed here, before the LR(0) automaton is built: the   */
+/*  rules of each nonterminal, the nullable symbols, the length of the  */
+/*  longest right-hand side, and the nonterminals that begin a rule of  */
+/*  each nonterminal.  One pass over ritem indexes the occurrences of   */
+/*  the nonterminals on the right-hand sides, and the rest is done with */
+/*  worklists, so that the time taken is linear in the size of the     */
+/*  grammar.                                                            */
+
+int maxrhs;
+short *first_map;
+short *first_symbols;
+
+static short *occ_start;
+static short *occ_rule;
+static short *pending;
+
+
+/**
+*   @brief Computes derives, nullable, maxrhs and the first symbols of the nonterminals
+*/
+analyze_grammar()
+{
+    index_grammar();
+    set_nullable();
+    set_first_symbols();
+
+    FREE(occ_start + start_symbol);
+    FREE(occ_rule);
+    FREE(pending);
+}
+
+
+/**
+*   @brief Lists the rules of each nonterminal and the rules in which each nonterminal occurs on the right-hand side
+*
+*   The lists of derives are in increasing order of rule and end with -1. A nonterminal that occurs several times in
+*   a rule is listed once for each occurrence in occ_rule[], from occ_start[] up to the start of the next one; the
+*   lists are filled by advancing their starts, which are moved back afterwards. pending[] gets the length of the
+*   right-hand side of each rule.
+*/
+index_grammar()
+{
+    register int i, j, rule;
+    register short *sp;
+    register short *rules;
+    register short *count;
+
+    derives = NEW2(nsyms, short *);
+    rules = NEW2(nvars + nrules, short);
+    count = NEW2(nvars + 1, short) - start_symbol;
+    occ_start = NEW2(nvars + 1, short) - start_symbol;
+    pending = NEW2(nrules, short);
+
+    maxrhs = 0;
+    for (rule = 2; rule < nrules; ++rule)
+    {
+        ++count[rlhs[rule]];
+        for (sp = ritem + rrhs[rule]; *sp >= 0; ++sp)
+            if (ISVAR(*sp))
+                ++occ_start[*sp + 1];
+        pending[rule] = sp - (ritem + rrhs[rule]);
+        if (pending[rule] > maxrhs)
+            maxrhs = pending[rule];
+    }
+
+    j = 0;
+    for (i = start_symbol; i < nsyms; ++i)
+    {
+        derives[i] = rules + j;
+        j += count[i];
+        rules[j++] = -1;
+        count[i] = 0;
+        occ_start[i + 1] += occ_start[i];
+    }
+
+    occ_rule = NEW2(occ_start[nsyms] + 1, short);
+    for (rule = 2; rule < nrules; ++rule)
+    {
+        i = rlhs[rule];
+        derives[i][count[i]++] = rule;
+        for (sp = ritem + rrhs[rule]; *sp >= 0; ++sp)
+            if (ISVAR(*sp))
+                occ_rule[occ_start[*sp]++] = rule;
+    }
+    for (i = nsyms - 1; i > start_symbol; --i)
+        occ_start[i] = occ_start[i - 1];
+    occ_start[start_symbol] = 0;
+
+    FREE(count + start_symbol);
+
+#ifdef DEBUG
+    print_derives();
+#endif
+}
+
+
+free_derives()
+{
+    FREE(derives[start_symbol]);
+    FREE(derives);
+}
+
+
+#ifdef DEBUG
+print_derives()
+{
+    register int i;
+    register short *sp;
+
+    printf("\nDERIVES\n\n");
+
+    for (i = start_symbol; i < nsyms; i++)
+    {
+        printf("%s derives ", symbol_name[i]);
+        for (sp = derives[i]; *sp >= 0; sp++)
+        {
+            printf("  %d", *sp);
+        }
+        putchar('\n');
+    }
+
+    putchar('\n');
+}
+#endif
+
+
+/**
+*   @brief Finds the nullable nonterminals
+*
+*   A rule is queued when every symbol of its right-hand side is known to be nullable, which makes its left-hand side
+*   nullable. Each occurrence of a nonterminal is counted down once, when the nonterminal becomes nullable; the
+*   occurrences of tokens are never counted down.
+*/
+set_nullable()
+{
+    register int i, j, rule, symbol;
+    register short *queue;
+    int head, tail;
+
+    nullable = NEW2(nsyms, char);
+    queue = NEW2(nrules, short);
+
+    tail = 0;
+    for (rule = 2; rule < nrules; ++rule)
+        if (pending[rule] == 0)
+            queue[tail++] = rule;
+
+    for (head = 0; head < tail; ++head)
+    {
+        symbol = rlhs[queue[head]];
+        if (nullable[symbol])
+            continue;
+        nullable[symbol] = 1;
+        for (i = occ_start[symbol]; i < occ_start[symbol + 1]; ++i)
+        {
+            j = occ_rule[i];
+            if (--pending[j] == 0)
+                queue[tail++] = j;
+        }
+    }
+
+    FREE(queue);
+
+#ifdef DEBUG
+    for (i = 0; i < nsyms; i++)
+    {
+        if (nullable[i])
+            printf("%s is nullable\n", symbol_name[i]);
+        else
+            printf("%s is not nullable\n", symbol_name[i]);
+    }
+#endif
+}
+
+
+free_nullable()
+{
+    FREE(nullable);
+}
+
+
+/**
+*   @brief Lists the nonterminals that begin a rule of each nonterminal
+*
+*   The nonterminals that begin a rule of a nonterminal are listed once each in first_symbols[], from first_map[] up
+*   to the start of the next list. set_EFF() closes this relation.
+*/
+set_first_symbols()
+{
+    register int i, k, symbol;
+    register short *sp;
+    register short *seen;
+
+    first_map = NEW2(nvars + 1, short) - start_symbol;
+    first_symbols = NEW2(nrules + 1, short);
+    seen = NEW2(nvars, short) - start_symbol;
+
+    k = 0;
+    for (i = start_symbol; i < nsyms; ++i)
+    {
+        first_map[i] = k;
+        for (sp = derives[i]; *sp >= 0; ++sp)
+        {
+            symbol = ritem[rrhs[*sp]];
+            if (ISVAR(symbol) && seen[symbol] != i + 1)
+            {
+                seen[symbol] = i + 1;
+                first_symbols[k++] = symbol;
+            }
+        }
+    }
+    first_map[nsyms] = k;
+
+    FREE(seen + start_symbol);
+}
+
+
+free_first_symbols()
+{
+    FREE(first_map + start_symbol);
+    FREE(first_symbols);
+}
@@ -45,39 +45,48 @@ static unsigned *EFF;
 *   
 *   Let \f$ V \f$ be the set of all variables (non-terminals) and \f$ \mathcal{P} \f$ the set of all productions.
 *
-*   For each non-terminal \f$ V_i \f$, scans all of its productions. If they start with a non-terminal \f$ V_j \f$,
-*   sets \f$ \mathrm{EFF}_{i,j} \f$, thus computing the direct epsilon-free firsts of \f$ V_i \f$. It then calls a
-*   function that computes the reflexive and transitive closure of such relation.
+*   The direct epsilon-free firsts of each non-terminal \f$ V_i \f$, the non-terminals that begin one of its
+*   productions, have been listed by set_first_symbols(). The row of \f$ V_i \f$ is filled by a search that starts
+*   from \f$ V_i \f$ and follows those lists, using the bits already set in the row to skip the non-terminals already
+*   found, which computes the reflexive and transitive closure of the relation in time proportional to the part of
+*   it that each row reaches.
 */
 set_EFF()
 {
     register unsigned *row;
     register int symbol;
-    register short *sp;
     register int rowsize;
-    register int i;
-    register int rule;
+    register int i, j, k;
+    register short *queue;
+    int head, tail;
 
     rowsize = WORDSIZE(nvars);
     EFF = NEW2(nvars * rowsize, unsigned);
+    queue = NEW2(nvars, short);
 
     row = EFF;
     for (i = start_symbol; i < nsyms; i++)
     {
-        sp = derives[i];
-        for (rule = *sp; rule > 0; rule = *++sp)
+        SETBIT(row, i - start_symbol);
+        queue[0] = i;
+        tail = 1;
+        for (head = 0; head < tail; ++head)
         {
-            symbol = ritem[rrhs[rule]];
-            if (ISVAR(symbol))
+            symbol = queue[head];
+            for (j = first_map[symbol]; j < first_map[symbol + 1]; ++j)
             {
-                symbol -= start_symbol;
-                SETBIT(row, symbol);
+                k = first_symbols[j];
+                if (!BIT(row, k - start_symbol))
+                {
+                    SETBIT(row, k - start_symbol);
+                    queue[tail++] = k;
+                }
             }
         }
         row += rowsize;
     }
 
-    reflexive_transitive_closure(EFF, nvars);
+    FREE(queue);
 
 #ifdef DEBUG
     print_EFF();
@@ -48,6 +48,7 @@
 #define CODE_SUFFIX	".code.c"
 #define	DEFINES_SUFFIX	".tab.h"
 #define	OUTPUT_SUFFIX	".tab.c"
+#define	CXX_OUTPUT_SUFFIX	".tab.hh"
 #define	VERBOSE_SUFFIX	".output"
 
 
@@ -130,6 +131,7 @@ struct core
 {
     struct core *next;
     struct core *link;
+    struct core *merged;
     short number;
     short accessing_symbol;
     short nitems;
@@ -176,6 +178,20 @@ struct action
 };
 
 
+/*  the structure used to locate the text of a semantic action  */
+
+typedef struct action_text action_text;
+struct action_text
+{
+    long offset;
+    long length;
+    int lineno;
+    short same;
+    short next;
+    char assigns;
+};
+
+
 /* global variables */
 
 extern char dflag;
@@ -183,6 +199,17 @@ extern char lflag;
 extern char rflag;
 extern char tflag;
 extern char vflag;
+extern char fnflag;
+extern char mgflag;
+extern char ipflag;
+extern char tsflag;
+extern char cxxflag;
+extern char ctflag;
+extern char itflag;
+extern char reflag;
+extern char tcflag;
+extern char urflag;
+extern char mcflag;
 extern char *symbol_prefix;
 
 extern char *myname;
@@ -191,16 +218,36 @@ extern char *line;
 extern int lineno;
 extern int outline;
 
+extern char *sccsid[];
 extern char *banner[];
 extern char *tables[];
+extern char *const_tables[];
 extern char *header[];
+extern char *globals[];
+extern char *handle[];
+extern char *incremental[];
+extern char *handle_functions[];
+extern char *snapshots[];
+extern char *batch[];
+extern char *chunks[];
+extern char *runtime[];
 extern char *body[];
+extern char *jumps[];
+extern char *returns[];
+extern char *switch_start[];
+extern char *switch_end[];
+extern char *call_action[];
 extern char *trailer[];
+extern char *cxx_header[];
+extern char *cxx_body[];
+extern char *cxx_switch_end[];
+extern char *cxx_trailer[];
 
 extern char *action_file_name;
 extern char *code_file_name;
 extern char *defines_file_name;
 extern char *input_file_name;
+extern char *profile_file_name;
 extern char *output_file_name;
 extern char *text_file_name;
 extern char *union_file_name;
@@ -221,6 +268,7 @@ extern int nsyms;
 extern int ntokens;
 extern int nvars;
 extern int ntags;
+extern char **tag_table;
 
 extern char unionized;
 extern char line_format[];
@@ -230,15 +278,20 @@ extern char  **symbol_name;
 extern short *symbol_value;
 extern short *symbol_prec;
 extern char  *symbol_assoc;
+extern short *symbol_slot;
 
 extern short *ritem;
 extern short *rlhs;
 extern short *rrhs;
 extern short *rprec;
 extern char  *rassoc;
+extern action_text *raction;
 
 extern short **derives;
 extern char *nullable;
+extern int maxrhs;
+extern short *first_map;
+extern short *first_symbols;
 
 extern bucket *first_symbol;
 extern bucket *last_symbol;
@@ -267,6 +320,18 @@ extern short *defred;
 extern short *rules_used;
 extern short nunused;
 extern short final_state;
+extern char *sync_token;
+extern short *token_class;
+extern int nclasses;
+extern int nbypassed;
+extern int nlatereds;
+extern int nlateentries;
+
+extern int nmerged;
+extern int nunreachable;
+
+extern long *row_weight;
+extern short *canonical_state;
 
 /* global functions */
 
@@ -308,6 +308,24 @@ int i;
 }
 
 
+typed_stack_error(a_lineno, i)
+int a_lineno;
+int i;
+{
+    fprintf(stderr, "%s: e - line %d of \"%s\", $%d cannot be accessed in \
+the typed value stack\n", myname, a_lineno, input_file_name, i);
+    done(1);
+}
+
+
+profile_error(msg)
+char *msg;
+{
+    fprintf(stderr, "%s: f - \"%s\", %s\n", myname, profile_file_name, msg);
+    done(2);
+}
+
+
 default_action_warning()
 {
     fprintf(stderr, "%s: w - line %d of \"%s\", the default action assigns an \
@@ -329,4 +347,12 @@ char *s;
     fprintf(stderr, "%s: w - the symbol %s is undefined\n", myname, s);
 }
 
+
+unproductive_goal_warning(s)
+char *s;
+{
+    fprintf(stderr, "%s: w - the start symbol %s derives no sentence\n",
+            myname, s);
+}
+
 /// @}
\ No newline at end of file
@@ -23,7 +23,6 @@ short *to_state;
 short **transpose();
 
 static int infinity;
-static int maxrhs;
 static int ngotos;
 static unsigned *F;
 static short **includes;
@@ -42,7 +41,6 @@ lalr()
     set_accessing_symbol();
     set_shift_table();
     set_reduction_table();
-    set_maxrhs();
     initialize_LA();
     set_goto_map();
     initialize_F();
@@ -97,34 +95,6 @@ set_reduction_table()
 
 
 
-set_maxrhs()
-{
-    register short *itemp;
-    register short *item_end;
-    register int length;
-    register int max;
-
-    length = 0;
-    max = 0;
-    item_end = ritem + nitems;
-    for (itemp = ritem; itemp < item_end; itemp++)
-    {
-        if (*itemp >= 0)
-        {
-            length++;
-        }
-        else
-        {
-            if (length > max) max = length;
-            length = 0;
-        }
-    }
-
-    maxrhs = max;
-}
-
-
-
 initialize_LA()
 {
     register int i, j, k;
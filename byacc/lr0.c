@@ -230,6 +230,7 @@ initialize_states()
 
     p->next = 0;
     p->link = 0;
+    p->merged = 0;
     p->number = 0;
     p->accessing_symbol = 0;
     p->nitems = i;
@@ -476,123 +477,9 @@ save_reductions()
 }
 
 
-set_derives()
-{
-    register int i, k;
-    register int lhs;
-    register short *rules;
-
-    derives = NEW2(nsyms, short *);
-    rules = NEW2(nvars + nrules, short);
-
-    k = 0;
-    for (lhs = start_symbol; lhs < nsyms; lhs++)
-    {
-        derives[lhs] = rules + k;
-        for (i = 0; i < nrules; i++)
-        {
-            if (rlhs[i] == lhs)
-            {
-                rules[k] = i;
-                k++;
-            }
-        }
-        rules[k] = -1;
-        k++;
-    }
-
-#ifdef DEBUG
-    print_derives();
-#endif
-}
-
-free_derives()
-{
-    FREE(derives[start_symbol]);
-    FREE(derives);
-}
-
-#ifdef DEBUG
-print_derives()
-{
-    register int i;
-    register short *sp;
-
-    printf("\nDERIVES\n\n");
-
-    for (i = start_symbol; i < nsyms; i++)
-    {
-        printf("%s derives ", symbol_name[i]);
-        for (sp = derives[i]; *sp >= 0; sp++)
-        {
-            printf("  %d", *sp);
-        }
-        putchar('\n');
-    }
-
-    putchar('\n');
-}
-#endif
-
-
-set_nullable()
-{
-    register int i, j;
-    register int empty;
-    int done;
-
-    nullable = MALLOC(nsyms);
-    if (nullable == 0) no_space();
-
-    for (i = 0; i < nsyms; ++i)
-        nullable[i] = 0;
-
-    done = 0;
-    while (!done)
-    {
-        done = 1;
-        for (i = 1; i < nitems; i++)
-        {
-            empty = 1;
-            while ((j = ritem[i]) >= 0)
-            {
-                if (!nullable[j])
-                    empty = 0;
-                ++i;
-            }
-            if (empty)
-            {
-                j = rlhs[-j];
-                if (!nullable[j])
-                {
-                    nullable[j] = 1;
-                    done = 0;
-                }
-            }
-        }
-    }
-
-#ifdef DEBUG
-    for (i = 0; i < nsyms; i++)
-    {
-        if (nullable[i])
-            printf("%s is nullable\n", symbol_name[i]);
-        else
-            printf("%s is not nullable\n", symbol_name[i]);
-    }
-#endif
-}
-
-
-free_nullable()
-{
-    FREE(nullable);
-}
-
-
 lr0()
 {
-    set_derives();
-    set_nullable();
+    analyze_grammar();
     generate_states();
+    free_first_symbols();
 }
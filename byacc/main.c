@@ -6,6 +6,17 @@ char lflag;
 char rflag;
 char tflag;
 char vflag;
+char fnflag;
+char mgflag;
+char ipflag;
+char tsflag;
+char cxxflag;
+char ctflag;
+char itflag;
+char reflag;
+char tcflag;
+char urflag;
+char mcflag;
 
 char *symbol_prefix;
 char *file_prefix = "y";
@@ -19,6 +30,7 @@ char *action_file_name;
 char *code_file_name;
 char *defines_file_name;
 char *input_file_name = "";
+char *profile_file_name;
 char *output_file_name;
 char *text_file_name;
 char *union_file_name;
@@ -92,6 +104,14 @@ short *symbol_value;
 short *symbol_prec;
 char  *symbol_assoc;
 
+/**
+*   @brief Slots of the symbols in the typed value stack
+*
+*   Only used with the --typed-stack option (see value_slot()): -1 if the symbol has no value, 0 if its value takes a
+*   whole YYSTYPE, k if its value has the type of the k-th %union tag.
+*/
+short *symbol_slot;
+
 /**
 *   @brief Representation of all productions (and items)
 *
@@ -127,6 +147,20 @@ short *rrhs;
 short *rprec;
 char  *rassoc;
 
+/**
+*   @brief Location of the semantic action of each rule
+*
+*   Array that associates to each rule the position and length of the code of its semantic action inside action_file,
+*   together with the line of the input file where the action begins. Rules without an action have a negative offset.
+*
+*   Rules whose actions are identical form a group: field same holds the number of the first rule of the group, whose
+*   code is the only one written, and field next links the following members (see merge_actions()).
+*
+*   The code is stored after the substitution of all $-names, so it can be written as it is to the output file,
+*   either as a case of the switch inside yyparse() or as the body of a separate function.
+*/
+action_text *raction;
+
 /**
 *   @brief List of rules that derive each non-terminal
 *
@@ -135,7 +169,7 @@ char  *rassoc;
 *   set and should not be accessed. They are only present to make the indexes consistent with other arrays (i.e. this
 *   array can be indexed using the symbol number).
 *
-*   Allocated and filled in set_first_derives().
+*   Allocated and filled in index_grammar().
 */
 short **derives;
 char *nullable;
@@ -201,11 +235,68 @@ set_signals()
 
 usage()
 {
-    fprintf(stderr, "usage: %s [-dlrtv] [-b file_prefix] [-p symbol_prefix] filename\n", myname);
+    fprintf(stderr, "usage: %s [-dlrtv] [-b file_prefix] [-p symbol_prefix] [-x language] [--action-functions] [--merge-actions] [--lex-in-place] [--typed-stack] [--const-tables] [--interleaved-tables] [--profile=file] [--reentrant] [--token-classes] [--unit-rules] [--default-reductions=most-common] filename\n", myname);
     exit(1);
 }
 
 
+/**
+*   @brief Parses a long option
+*
+*   Long options are introduced by a double dash and spelled out in full, so that the growing set of code generation
+*   choices does not exhaust the single-letter flags.
+*
+*   @param[in] s The name of the option, without the leading dashes
+*/
+long_option(s)
+char *s;
+{
+    if (strcmp(s, "action-functions") == 0)
+        fnflag = 1;
+    else if (strcmp(s, "merge-actions") == 0)
+        mgflag = 1;
+    else if (strcmp(s, "lex-in-place") == 0)
+        ipflag = 1;
+    else if (strcmp(s, "typed-stack") == 0)
+        tsflag = 1;
+    else if (strcmp(s, "const-tables") == 0)
+        ctflag = 1;
+    else if (strcmp(s, "interleaved-tables") == 0)
+        itflag = 1;
+    else if (strncmp(s, "profile=", 8) == 0 && s[8])
+        profile_file_name = s + 8;
+    else if (strcmp(s, "reentrant") == 0)
+        reflag = 1;
+    else if (strcmp(s, "token-classes") == 0)
+        tcflag = 1;
+    else if (strcmp(s, "unit-rules") == 0)
+        urflag = 1;
+    else if (strcmp(s, "default-reductions=most-common") == 0)
+        mcflag = 1;
+    else if (strcmp(s, "default-reductions=consistent") == 0)
+        mcflag = 0;
+    else
+        usage();
+}
+
+
+/**
+*   @brief Selects the language of the generated parser
+*
+*   @param[in] s The argument of the -x option: "c" (the default) or "c++"
+*/
+language(s)
+char *s;
+{
+    if (strcmp(s, "c++") == 0)
+        cxxflag = 1;
+    else if (strcmp(s, "c") == 0)
+        cxxflag = 0;
+    else
+        usage();
+}
+
+
 getargs(argc, argv)
 int argc;
 char *argv[];
@@ -226,6 +317,11 @@ char *argv[];
             return;
 
         case '-':
+            if (*++s)
+            {
+                long_option(s);
+                continue;
+            }
             ++i;
             goto no_more_options;
 
@@ -267,6 +363,15 @@ char *argv[];
             vflag = 1;
             break;
 
+        case 'x':
+            if (*++s)
+                language(s);
+            else if (++i < argc)
+                language(argv[i]);
+            else
+                usage();
+            continue;
+
         default:
             usage();
         }
@@ -308,6 +413,12 @@ end_of_option:;
 no_more_options:;
     if (i + 1 != argc) usage();
     input_file_name = argv[i];
+    if (ipflag && tsflag)
+        fatal("--lex-in-place cannot be used with --typed-stack");
+    if (reflag && fnflag)
+        fatal("--reentrant cannot be used with --action-functions");
+    if (cxxflag && (rflag || fnflag || ipflag || tsflag || ctflag || itflag || reflag || tcflag))
+        fatal("-x c++ cannot be used with -r, --action-functions, --lex-in-place, --typed-stack, --const-tables, --interleaved-tables, --reentrant or --token-classes");
 }
 
 
@@ -373,11 +484,11 @@ create_file_names()
 
     len = strlen(file_prefix);
 
-    output_file_name = MALLOC(len + 7);
+    output_file_name = MALLOC(len + 8);
     if (output_file_name == 0)
         no_space();
     strcpy(output_file_name, file_prefix);
-    strcpy(output_file_name + len, OUTPUT_SUFFIX);
+    strcpy(output_file_name + len, cxxflag ? CXX_OUTPUT_SUFFIX : OUTPUT_SUFFIX);
 
     if (rflag)
     {
@@ -473,6 +584,7 @@ char *argv[];
     lr0();
     lalr();
     make_parser();
+    if (profile_file_name) profile();
     verbose();
     output();
     done(0);
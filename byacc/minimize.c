@@ -0,0 +1,395 @@
+#include "defs.h"
+
+/*  The states of the LR(0) automaton are minimized once the actions    */
+/*  of the parser are known.  Two states are equivalent when they have  */
+/*  the same actions after the conflicts are resolved, the same default */
+/*  reduction, and shifts and gotos on the same symbols that lead to    */
+/*  equivalent states; the parser cannot tell them apart, so one row of */
+/*  the tables is enough for both.  The states that no shift or goto   */
+/*  leads to any more, after --unit-rules, are dropped at the same      */
+/*  time.                                                               */
+
+int nmerged;
+int nunreachable;
+
+static short *reach;
+static int nreach;
+static short *block;
+static short *goto_first;
+static short *goto_next;
+static short *goto_symbol;
+static int *vstart;
+static int *vdata;
+static int vsize;
+
+
+/**
+*   @brief Minimizes the parser by merging its equivalent states and dropping the unreachable ones
+*
+*   The partition of the states starts from their actions and is refined by the blocks of the states that their
+*   shifts and gotos lead to, until no block splits any more. State 0 and the final state are kept apart, since the
+*   parser treats them specially, and so are the states with conflicts, so that y.output still reports each of them,
+*   and the states whose values have different slots with --typed-stack. The states are renumbered in the order of
+*   their first member, so that state 0 stays the initial state.
+*/
+minimize_states()
+{
+    register int n, last;
+
+    link_gotos();
+    find_reachable();
+
+    vstart = NEW2(nreach + 1, int);
+    vsize = 0;
+    vdata = 0;
+    block = NEW2(nreach, short);
+
+    action_vectors();
+    n = partition();
+    do
+    {
+        last = n;
+        transition_vectors();
+        n = partition();
+    }
+    while (n != last);
+
+    nunreachable = nstates - nreach;
+    nmerged = nreach - n;
+    if (nunreachable || nmerged)
+        merge_states(n);
+
+    FREE(vstart);
+    FREE(vdata);
+    FREE(block);
+    FREE(reach);
+    FREE(goto_first);
+    FREE(goto_next);
+    FREE(goto_symbol);
+}
+
+
+/**
+*   @brief Lists the gotos of each state, in the order of their symbols
+*/
+link_gotos()
+{
+    register int i, k;
+
+    goto_first = NEW2(nstates, short);
+    goto_next = NEW2(goto_map[nsyms], short);
+    goto_symbol = NEW2(goto_map[nsyms], short);
+    for (i = 0; i < nstates; ++i)
+        goto_first[i] = -1;
+
+    for (i = nsyms - 1; i >= ntokens; --i)
+    {
+        for (k = goto_map[i + 1] - 1; k >= goto_map[i]; --k)
+        {
+            goto_symbol[k] = i;
+            goto_next[k] = goto_first[from_state[k]];
+            goto_first[from_state[k]] = k;
+        }
+    }
+}
+
+
+/**
+*   @brief Lists the states that the parser can enter from state 0, in increasing order
+*/
+find_reachable()
+{
+    register int i, j, k, s;
+    register action *p;
+    register short *queue;
+    register char *seen;
+
+    queue = NEW2(nstates, short);
+    seen = NEW2(nstates, char);
+    queue[0] = 0;
+    seen[0] = 1;
+    j = 1;
+    for (i = 0; i < j; ++i)
+    {
+        s = queue[i];
+        for (p = parser[s]; p; p = p->next)
+        {
+            if (p->action_code == SHIFT && p->suppressed == 0 && !seen[p->number])
+            {
+                seen[p->number] = 1;
+                queue[j++] = p->number;
+            }
+        }
+        for (k = goto_first[s]; k >= 0; k = goto_next[k])
+        {
+            if (!seen[to_state[k]])
+            {
+                seen[to_state[k]] = 1;
+                queue[j++] = to_state[k];
+            }
+        }
+    }
+
+    reach = NEW2(j, short);
+    nreach = 0;
+    for (i = 0; i < nstates; ++i)
+        if (seen[i]) reach[nreach++] = i;
+
+    FREE(queue);
+    FREE(seen);
+}
+
+
+/**
+*   @brief Appends a value to the vector of a state, growing vdata as needed
+*/
+add_value(value)
+int value;
+{
+    if (vdata == 0 || vstart[nreach] >= vsize)
+    {
+        vsize = vsize ? 2*vsize : 4*nreach + 16;
+        vdata = (int *) REALLOC(vdata, vsize*sizeof(int));
+        if (vdata == 0) no_space();
+    }
+    vdata[vstart[nreach]++] = value;
+}
+
+
+/**
+*   @brief Describes each state by its actions, without the states that they lead to, for the first partition
+*/
+action_vectors()
+{
+    register int i, s;
+    register action *p;
+    register int k;
+
+    vstart[nreach] = 0;
+    for (i = 0; i < nreach; ++i)
+    {
+        s = reach[i];
+        vstart[i] = vstart[nreach];
+        if (s == 0 || s == final_state || SRconflicts[s] || RRconflicts[s])
+            add_value(-1 - s);
+        else
+            add_value(0);
+        add_value(defred[s]);
+        add_value(tsflag ? symbol_slot[accessing_symbol[s]] : 0);
+        for (p = parser[s]; p; p = p->next)
+        {
+            if (p->suppressed)
+                continue;
+            add_value(p->symbol);
+            add_value(p->action_code == REDUCE ? p->number : -1);
+        }
+        for (k = goto_first[s]; k >= 0; k = goto_next[k])
+            add_value(goto_symbol[k]);
+    }
+}
+
+
+/**
+*   @brief Describes each state by its block and by the blocks of the states that its shifts and gotos lead to
+*
+*   The states of a block have shifts and gotos on the same symbols, in the same order, so the blocks of their
+*   targets can be compared position by position.
+*/
+transition_vectors()
+{
+    register int i, s;
+    register action *p;
+    register int k;
+    register short *index;
+
+    index = NEW2(nstates, short);
+    for (i = 0; i < nreach; ++i)
+        index[reach[i]] = i;
+
+    vstart[nreach] = 0;
+    for (i = 0; i < nreach; ++i)
+    {
+        s = reach[i];
+        vstart[i] = vstart[nreach];
+        add_value(block[i]);
+        for (p = parser[s]; p; p = p->next)
+        {
+            if (p->action_code == SHIFT && p->suppressed == 0)
+                add_value(block[index[p->number]]);
+        }
+        for (k = goto_first[s]; k >= 0; k = goto_next[k])
+            add_value(block[index[to_state[k]]]);
+    }
+
+    FREE(index);
+}
+
+
+/**
+*   @brief Puts the states with equal vectors in the same block
+*
+*   @return The number of blocks, which are numbered in the order of their first state
+*/
+int
+partition()
+{
+    register int i, j, k, n;
+    register unsigned h;
+    register int len;
+    register int *head;
+    register int *chain;
+    register unsigned *hash;
+
+    head = NEW2(nreach, int);
+    chain = NEW2(nreach, int);
+    hash = NEW2(nreach, unsigned);
+    for (i = 0; i < nreach; ++i)
+        head[i] = -1;
+
+    n = 0;
+    for (i = 0; i < nreach; ++i)
+    {
+        h = 0;
+        for (k = vstart[i]; k < vstart[i + 1]; ++k)
+            h = h * 31 + vdata[k];
+        hash[i] = h;
+        len = vstart[i + 1] - vstart[i];
+
+        for (j = head[h % nreach]; j >= 0; j = chain[j])
+        {
+            if (hash[j] == h && vstart[j + 1] - vstart[j] == len)
+            {
+                for (k = 0; k < len; ++k)
+                    if (vdata[vstart[i] + k] != vdata[vstart[j] + k])
+                        break;
+                if (k == len)
+                    break;
+            }
+        }
+
+        if (j >= 0)
+            block[i] = block[j];
+        else
+        {
+            block[i] = n++;
+            chain[i] = head[h % nreach];
+            head[h % nreach] = i;
+        }
+    }
+
+    FREE(head);
+    FREE(chain);
+    FREE(hash);
+    return (n);
+}
+
+
+/**
+*   @brief Keeps the first state of each block as the state with the number of the block
+*
+*   The tables indexed by state are compacted, the shifts are renumbered, and the gotos are rebuilt from those of
+*   the states kept, which replace the gotos of the states merged into them. The cores of the states merged into a
+*   state are chained to its own by their merged field, for y.output. The targets in shift_table keep the
+*   numbers of the LR(0) automaton: after make_parser() the shifts and gotos are read from parser and from the goto
+*   tables only.
+*
+*   @param[in] n The number of blocks
+*/
+merge_states(n)
+int n;
+{
+    register int i, k, s;
+    register action *p;
+    register short *map;
+    register short *rep;
+    register short *count;
+    short *fv, *tv;
+    action **av;
+
+    map = NEW2(nstates, short);
+    rep = NEW2(n, short);
+    for (i = 0; i < nstates; ++i)
+        map[i] = -1;
+    for (i = nreach - 1; i >= 0; --i)
+    {
+        map[reach[i]] = block[i];
+        rep[block[i]] = reach[i];
+    }
+
+    for (i = nreach - 1; i >= 0; --i)
+    {
+        s = reach[i];
+        if (rep[block[i]] != s)
+        {
+            state_table[s]->merged = state_table[rep[block[i]]]->merged;
+            state_table[rep[block[i]]]->merged = state_table[s];
+        }
+    }
+
+    av = NEW2(n, action *);
+    for (i = 0; i < nstates; ++i)
+    {
+        if (map[i] >= 0 && rep[map[i]] == i)
+        {
+            for (p = parser[i]; p; p = p->next)
+            {
+                if (p->action_code == SHIFT && map[p->number] >= 0)
+                    p->number = map[p->number];
+            }
+            av[map[i]] = parser[i];
+        }
+        else
+            free_action_row(parser[i]);
+    }
+    FREE(parser);
+    parser = av;
+
+    for (i = 0; i < n; ++i)
+    {
+        s = rep[i];
+        state_table[i] = state_table[s];
+        state_table[i]->number = i;
+        shift_table[i] = shift_table[s];
+        if (shift_table[i])
+            shift_table[i]->number = i;
+        reduction_table[i] = reduction_table[s];
+        if (reduction_table[i])
+            reduction_table[i]->number = i;
+        defred[i] = defred[s];
+        accessing_symbol[i] = accessing_symbol[s];
+        SRconflicts[i] = SRconflicts[s];
+        RRconflicts[i] = RRconflicts[s];
+    }
+
+    count = NEW2(nsyms + 1, short);
+    for (i = 0; i < n; ++i)
+        for (k = goto_first[rep[i]]; k >= 0; k = goto_next[k])
+            ++count[goto_symbol[k] + 1];
+    for (i = ntokens; i < nsyms; ++i)
+        count[i + 1] += count[i];
+
+    fv = NEW2(count[nsyms], short);
+    tv = NEW2(count[nsyms], short);
+    for (i = ntokens; i <= nsyms; ++i)
+        goto_map[i] = count[i];
+    for (i = 0; i < n; ++i)
+    {
+        for (k = goto_first[rep[i]]; k >= 0; k = goto_next[k])
+        {
+            s = count[goto_symbol[k]]++;
+            fv[s] = i;
+            tv[s] = map[to_state[k]];
+        }
+    }
+    FREE(from_state);
+    FREE(to_state);
+    from_state = fv;
+    to_state = tv;
+
+    final_state = map[final_state];
+    nstates = n;
+
+    FREE(count);
+    FREE(rep);
+    FREE(map);
+}
@@ -10,14 +10,30 @@ short *defred;
 short *rules_used;
 short nunused;
 short final_state;
+char *sync_token;
+short *token_class;
+int nclasses;
+int nbypassed;
+int nlatereds;
+int nlateentries;
 
 static int SRcount;
 static int RRcount;
 
+static short **pred_state;
+static short *reached;
+static short *work;
+static short *step_set;
+static short *next_set;
+static short *in_set;
+static short *unit_rule;
+static char *bypassed;
+
 extern action *parse_actions();
 extern action *get_shifts();
 extern action *add_reductions();
 extern action *add_reduce();
+extern char *cyclic_symbols();
 
 
 make_parser()
@@ -33,6 +49,10 @@ make_parser()
     unused_rules();
     if (SRtotal + RRtotal > 0) total_conflicts();
     defreds();
+    if (vflag || reflag) find_sync_tokens();
+    if (urflag) bypass_unit_rules();
+    minimize_states();
+    if (tcflag) find_token_classes();
 }
 
 
@@ -330,6 +350,123 @@ defreds()
     defred = NEW2(nstates, short);
     for (i = 0; i < nstates; i++)
         defred[i] = sole_reduction(i);
+    if (mcflag) most_common_reductions();
+}
+
+
+/**
+*   @brief Makes the most frequent reduction of each state its default reduction (--default-reductions=most-common)
+*
+*   The tables leave out the entries of the default reduction, and the parser makes it for every token that they do
+*   not list, so that an error is only detected in the state that the reductions lead to, although still before the
+*   token is shifted. The states that shift the error token keep their entries, since reducing there would pop the
+*   state that error recovery resumes from, and so does the final state. Ties go to the rule that comes first.
+*
+*   The parser can only reduce forever without shifting if some nonterminal derives itself, through the rules of
+*   that nonterminal and of nullable ones. In such a grammar those rules are never made the default, so that the
+*   parser detects the error instead.
+*/
+most_common_reductions()
+{
+    register int i, rule, best;
+    register action *p;
+    register short *count;
+    register char *unsafe;
+
+    unsafe = cyclic_symbols();
+    for (i = start_symbol; i < nsyms; ++i)
+        if (unsafe[i]) break;
+    if (i < nsyms)
+        for (i = start_symbol; i < nsyms; ++i)
+            if (nullable[i]) unsafe[i] = 1;
+
+    count = NEW2(nrules, short);
+    nlatereds = 0;
+    nlateentries = 0;
+    for (i = 0; i < nstates; ++i)
+    {
+        if (defred[i] || i == final_state)
+            continue;
+
+        best = 0;
+        for (p = parser[i]; p; p = p->next)
+        {
+            if (p->suppressed)
+                continue;
+            if (p->action_code == SHIFT && p->symbol == 1)
+                break;
+            if (p->action_code == REDUCE && p->symbol != 1 &&
+                    !unsafe[rlhs[p->number]])
+            {
+                rule = p->number;
+                ++count[rule];
+                if (count[rule] > count[best] ||
+                        count[rule] == count[best] && rule < best)
+                    best = rule;
+            }
+        }
+
+        if (p == 0 && best)
+        {
+            defred[i] = best;
+            ++nlatereds;
+            nlateentries += count[best];
+        }
+        for (p = parser[i]; p; p = p->next)
+            if (p->action_code == REDUCE)
+                count[p->number] = 0;
+    }
+    FREE(count);
+    FREE(unsafe);
+}
+
+
+/**
+*   @brief Finds the nonterminals that derive themselves, A =>+ A
+*
+*   A derives B in one step when a rule of A has B on its right-hand side and every other symbol there is a nullable
+*   nonterminal; the nonterminals that derive themselves are those on a cycle of the transitive closure of that
+*   relation.
+*
+*   @return An array indexed by symbol, nonzero for the nonterminals on a cycle
+*/
+char *
+cyclic_symbols()
+{
+    register int i, j, k, rule, rowsize;
+    register unsigned *R;
+    register short *sp;
+    register char *cyclic;
+
+    rowsize = WORDSIZE(nvars);
+    R = NEW2(nvars * rowsize, unsigned);
+    for (rule = 3; rule < nrules; ++rule)
+    {
+        sp = ritem + rrhs[rule];
+        for (i = 0; sp[i] >= 0; ++i)
+        {
+            if (!ISVAR(sp[i]))
+                continue;
+            for (j = 0; sp[j] >= 0; ++j)
+                if (j != i && !nullable[sp[j]])
+                    break;
+            if (sp[j] < 0)
+            {
+                k = rlhs[rule] - start_symbol;
+                SETBIT(R + k * rowsize, sp[i] - start_symbol);
+            }
+        }
+    }
+    transitive_closure(R, nvars);
+
+    cyclic = NEW2(nsyms, char);
+    for (i = start_symbol; i < nsyms; ++i)
+    {
+        k = i - start_symbol;
+        cyclic[i] = BIT(R + k * rowsize, k);
+    }
+    FREE(R);
+    return (cyclic);
 }
  
 free_action_row(p)
@@ -355,3 +492,353 @@ free_parser()
     FREE(parser);
 }
 
+
+
+/**
+*   @brief Finds the tokens after which the parser is always back at the top level
+*
+*   A token is restart-safe if, whatever state shifts it, the default reductions that follow lead without reading
+*   another token to final_state, which the parser enters only from state 0 with the start symbol. The stack is
+*   then known to be exactly 0, final_state, so a parse can be started in that state at the next token (see
+*   yyparse_chunks in skeleton.c). The states revealed by each reduction are found by walking back through the
+*   predecessors of the state, which may include more states than the parser can actually reveal, so a token may
+*   be missed but is never wrongly reported.
+*/
+find_sync_tokens()
+{
+    register int i, j, k, t;
+    register shifts *sp;
+    short *npreds;
+
+    npreds = NEW2(nstates, short);
+    for (i = 0; i < nstates; ++i)
+        if (sp = shift_table[i])
+            for (j = 0; j < sp->nshifts; ++j)
+                ++npreds[sp->shift[j]];
+
+    pred_state = NEW2(nstates, short *);
+    for (i = 0; i < nstates; ++i)
+    {
+        pred_state[i] = NEW2(npreds[i] + 1, short);
+        pred_state[i][npreds[i]] = -1;
+        npreds[i] = 0;
+    }
+    for (i = 0; i < nstates; ++i)
+        if (sp = shift_table[i])
+            for (j = 0; j < sp->nshifts; ++j)
+            {
+                k = sp->shift[j];
+                pred_state[k][npreds[k]++] = i;
+            }
+    FREE(npreds);
+
+    reached = NEW2(nstates, short);
+    work = NEW2(nstates, short);
+    step_set = NEW2(nstates, short);
+    next_set = NEW2(nstates, short);
+    in_set = NEW2(nstates, short);
+
+    sync_token = NEW2(ntokens, char);
+    for (t = 2; t < ntokens; ++t)
+        sync_token[t] = 2;
+    for (i = 0; i < nstates; ++i)
+        if (sp = shift_table[i])
+            for (j = 0; j < sp->nshifts; ++j)
+            {
+                k = sp->shift[j];
+                t = accessing_symbol[k];
+                if (t >= 2 && ISTOKEN(t) && sync_token[t])
+                    sync_token[t] = returns_to_final(k);
+            }
+    for (t = 2; t < ntokens; ++t)
+        if (sync_token[t] == 2)
+            sync_token[t] = 0;
+
+    for (i = 0; i < nstates; ++i)
+        FREE(pred_state[i]);
+    FREE(pred_state);
+    FREE(reached);
+    FREE(work);
+    FREE(step_set);
+    FREE(next_set);
+    FREE(in_set);
+}
+
+
+/**
+*   @brief Tells whether the default reductions from a state always lead to final_state
+*
+*   reached[] and in_set[] are all zero between calls. The states reached are kept in work[], which is walked as a
+*   queue, and each step of a reduction clears the marks of the states it put in next_set[], so that only the
+*   entries that were set are reset, rather than the whole arrays for every token and reduction.
+*/
+int
+returns_to_final(state)
+int state;
+{
+    register int i, j, k, s, n;
+    register short *p;
+    register shifts *sp;
+    int head, nwork, nstep, nnext, rule, safe;
+
+    reached[state] = 1;
+    work[0] = state;
+    nwork = 1;
+    safe = 1;
+    for (head = 0; safe && head < nwork; ++head)
+    {
+        s = work[head];
+        if (s == final_state) continue;
+        rule = immediate_reduction(s);
+        if (rule == 0)
+        {
+            safe = 0;
+            continue;
+        }
+
+        step_set[0] = s;
+        nstep = 1;
+        for (n = rrhs[rule + 1] - rrhs[rule] - 1; n > 0; --n)
+        {
+            nnext = 0;
+            for (i = 0; i < nstep; ++i)
+                for (p = pred_state[step_set[i]]; *p >= 0; ++p)
+                    if (!in_set[*p])
+                    {
+                        in_set[*p] = 1;
+                        next_set[nnext++] = *p;
+                    }
+            for (i = 0; i < nnext; ++i)
+            {
+                in_set[next_set[i]] = 0;
+                step_set[i] = next_set[i];
+            }
+            nstep = nnext;
+        }
+
+        for (i = 0; i < nstep; ++i)
+        {
+            sp = shift_table[step_set[i]];
+            k = -1;
+            if (sp)
+                for (j = 0; j < sp->nshifts; ++j)
+                    if (accessing_symbol[sp->shift[j]] == rlhs[rule])
+                        k = sp->shift[j];
+            if (k < 0)
+            {
+                safe = 0;
+                break;
+            }
+            if (!reached[k])
+            {
+                reached[k] = 1;
+                work[nwork++] = k;
+            }
+        }
+    }
+
+    for (i = 0; i < nwork; ++i)
+        reached[work[i]] = 0;
+    return (safe);
+}
+
+
+/**
+*   @brief Groups the tokens whose actions are the same in every state into classes (--token-classes)
+*
+*   The column of a token is the list of its actions in the tables, ordered by state; the default reductions are
+*   left out, since the tables do not hold them. Tokens with equal columns share a class, found by comparing the
+*   column with those of the classes that have the same hash. Class 0 is kept for the tokens that have no action
+*   anywhere, which the parser also uses for the token values that name no token, so the tables need no entries for
+*   it.
+*/
+find_token_classes()
+{
+    register int i, j, k, n;
+    register action *p;
+    register short *col;
+    int *start, *rep;
+    unsigned *hash;
+
+    start = NEW2(ntokens + 1, int);
+    for (i = 0; i < nstates; ++i)
+        for (p = parser[i]; p; p = p->next)
+            if (is_table_action(p, i))
+                ++start[p->symbol + 1];
+    for (i = 0; i < ntokens; ++i)
+        start[i + 1] += start[i];
+
+    /*  Fill the columns in state order, using rep[] as the fill pointers  */
+    col = NEW2(2 * start[ntokens] + 1, short);
+    rep = NEW2(ntokens, int);
+    for (i = 0; i < ntokens; ++i)
+        rep[i] = start[i];
+    for (i = 0; i < nstates; ++i)
+    {
+        for (p = parser[i]; p; p = p->next)
+        {
+            if (is_table_action(p, i))
+            {
+                k = 2 * rep[p->symbol]++;
+                col[k] = i;
+                col[k + 1] = p->action_code == SHIFT ? p->number : -p->number;
+            }
+        }
+    }
+
+    hash = NEW2(ntokens, unsigned);
+    for (i = 0; i < ntokens; ++i)
+        for (k = 2 * start[i]; k < 2 * start[i + 1]; ++k)
+            hash[i] = hash[i] * 31 + col[k];
+
+    token_class = NEW2(ntokens, short);
+    nclasses = 1;
+    for (i = 0; i < ntokens; ++i)
+    {
+        n = start[i + 1] - start[i];
+        if (n == 0) continue;
+        for (j = 1; j < nclasses; ++j)
+        {
+            k = rep[j];
+            if (hash[k] != hash[i] || start[k + 1] - start[k] != n) continue;
+            for (n = 2 * n - 1; n >= 0; --n)
+                if (col[2 * start[k] + n] != col[2 * start[i] + n])
+                    break;
+            if (n < 0) break;
+            n = start[i + 1] - start[i];
+        }
+        if (j == nclasses)
+            rep[nclasses++] = i;
+        token_class[i] = j;
+    }
+
+    FREE(start);
+    FREE(col);
+    FREE(rep);
+    FREE(hash);
+}
+
+
+/**
+*   @brief Returns the default reduction of a state if the parser makes it without reading a token, 0 otherwise
+*
+*   That is the case when the state has no other action. With --default-reductions=most-common, the default
+*   reduction of a state that also shifts or reduces by other rules is made only for the tokens that the tables do not
+*   list.
+*/
+int
+immediate_reduction(state)
+int state;
+{
+    register action *p;
+
+    if (defred[state] == 0)
+        return (0);
+    for (p = parser[state]; p; p = p->next)
+        if (is_table_action(p, state))
+            return (0);
+    return (defred[state]);
+}
+
+
+/**
+*   @brief Tells whether an action of a state is written to the tables, rather than resolved away or made the default
+*/
+int
+is_table_action(p, state)
+register action *p;
+int state;
+{
+    return (p->suppressed == 0 && (p->action_code == SHIFT ||
+            p->action_code == REDUCE && p->number != defred[state]));
+}
+
+
+/**
+*   @brief Returns the unit rule that a state reduces by default, or 0 if the state cannot be bypassed
+*
+*   A unit rule has one symbol on its right-hand side and no action, so that reducing by it changes nothing but the
+*   state on top of the stack. With --typed-stack the two symbols must also have the same slot on the value stack.
+*/
+int
+state_unit_rule(state)
+int state;
+{
+    register int rule;
+
+    rule = immediate_reduction(state);
+    if (rule < 3 || state == final_state)
+        return (0);
+    if (rrhs[rule + 1] - rrhs[rule] != 2 || raction[rule].offset >= 0)
+        return (0);
+    if (tsflag && symbol_slot[rlhs[rule]] != symbol_slot[ritem[rrhs[rule]]])
+        return (0);
+    return (rule);
+}
+
+
+/**
+*   @brief Returns the state that a transition from a state should lead to once the unit rules are bypassed
+*
+*   Entering a state that only reduces by a unit rule A : B pops it again and goes to the goto of the state below
+*   on A, which is the state that the transition started from, so the transition can lead to that goto directly.
+*   The goto is followed as long as it leads to another such state, but never into the final state, which the
+*   parser only enters through the special path for the start symbol at the bottom of the stack.
+*
+*   @param[in] from The state that the transition starts from
+*   @param[in] to The state that the transition leads to in the LR(0) automaton
+*   @return The state that the transition should lead to
+*/
+int
+bypass_target(from, to)
+int from;
+int to;
+{
+    register int i, rule, next;
+
+    for (i = 0; i < nstates && (rule = unit_rule[to]); ++i)
+    {
+        next = to_state[map_goto(from, rlhs[rule])];
+        if (next == final_state)
+            break;
+        bypassed[rule] = 1;
+        to = next;
+    }
+    return (to);
+}
+
+
+/**
+*   @brief Bypasses the unit rules without actions by rewriting the shifts and gotos that lead to them (--unit-rules)
+*
+*   The states that reduce by such a rule by default stay in the tables, but no transition leads to them any more
+*   except where the bypass would enter the final state, and the parser no longer performs the reductions. The rules
+*   that have been bypassed at least once are counted in nbypassed for y.output.
+*/
+bypass_unit_rules()
+{
+    register int i;
+    register action *p;
+
+    unit_rule = NEW2(nstates, short);
+    bypassed = NEW2(nrules, char);
+    for (i = 0; i < nstates; ++i)
+        unit_rule[i] = state_unit_rule(i);
+
+    for (i = 0; i < nstates; ++i)
+    {
+        for (p = parser[i]; p; p = p->next)
+        {
+            if (p->action_code == SHIFT && p->suppressed == 0)
+                p->number = bypass_target(i, p->number);
+        }
+    }
+    for (i = goto_map[ntokens]; i < goto_map[nsyms]; ++i)
+        to_state[i] = bypass_target(from_state[i], to_state[i]);
+
+    nbypassed = 0;
+    for (i = 3; i < nrules; ++i)
+        if (bypassed[i]) ++nbypassed;
+    FREE(unit_rule);
+    FREE(bypassed);
+}
@@ -15,31 +15,120 @@ static short *table;
 static short *check;
 static int lowzero;
 static int high;
+static char *storage;   /*  storage class of the tables  */
+static int table_offset;        /*  offset of the next table in yytables  */
+
+extern long vector_weight();
 
 
 output()
 {
+    storage = cxxflag ? "static constexpr " : ctflag ? "const " : "";
     free_itemsets();
     free_shifts();
     free_reductions();
     output_prefix();
     output_stored_text();
     output_defines();
+    if (cxxflag) begin_tables_struct();
     output_rule_data();
-    output_yydefred();
+    if (!itflag) output_yydefred();
     output_actions();
+    if (!cxxflag) output_expected();
     free_parser();
     output_debug();
+    if (cxxflag) end_tables_struct();
+    else
+    {
+        if (canonical_state) output_canonical();
+        if (reflag) output_sync();
+    }
+    FREE(sync_token);
     output_stype();
-    if (rflag) write_section(tables);
-    write_section(header);
+    if (tsflag) output_typed_stack();
+    if (rflag) write_section(ctflag ? const_tables : tables);
+    if (cxxflag)
+        write_section(cxx_header);
+    else
+        output_header();
     output_trailing_text();
-    write_section(body);
-    output_semantic_actions();
+    if (cxxflag)
+    {
+        write_section(jumps);
+        write_section(cxx_body);
+        write_section(switch_start);
+        output_semantic_actions();
+        write_section(cxx_switch_end);
+        write_section(cxx_trailer);
+        ++outline;
+        fprintf(code_file, "#endif\n");
+        return;
+    }
+    if (fnflag)
+    {
+        output_action_functions();
+        write_section(body);
+        write_section(call_action);
+    }
+    else
+    {
+        write_section(jumps);
+        write_section(body);
+        write_section(switch_start);
+        output_semantic_actions();
+        write_section(switch_end);
+    }
     write_section(trailer);
 }
 
 
+/**
+*   @brief Opens the include guard of the C++ parser
+*
+*   y.tab.hh is wrapped in #ifndef YY_<prefix>_TAB_HH, with the symbol prefix in upper case, so that it may be
+*   included more than once in a translation unit. output() closes the guard after the last section.
+*/
+begin_include_guard()
+{
+    register char *s;
+
+    s = symbol_prefix ? symbol_prefix : "yy";
+    outline += 2;
+    fprintf(code_file, "#ifndef YY_");
+    for (; *s; ++s)
+        putc(islower(*s) ? toupper(*s) : *s, code_file);
+    fprintf(code_file, "_TAB_HH\n#define YY_");
+    for (s = symbol_prefix ? symbol_prefix : "yy"; *s; ++s)
+        putc(islower(*s) ? toupper(*s) : *s, code_file);
+    fprintf(code_file, "_TAB_HH\n");
+}
+
+
+/**
+*   @brief Writes the declarations and the support functions of a C parser
+*
+*   The state of the parser is kept in global variables, or with --reentrant in a struct yyhandle, along with the
+*   functions that set up a handle and the incremental reparsing, snapshots, batches and chunks that work on it; the
+*   code of only one of the two is written. Snapshots cannot be taken of a typed stack.
+*/
+output_header()
+{
+    write_section(header);
+    if (reflag)
+    {
+        write_section(handle);
+        write_section(incremental);
+        write_section(handle_functions);
+        if (!tsflag) write_section(snapshots);
+        write_section(batch);
+        write_section(chunks);
+    }
+    else
+        write_section(globals);
+    write_section(runtime);
+}
+
+
 output_prefix()
 {
     if (symbol_prefix == NULL)
@@ -48,6 +137,14 @@ output_prefix()
     {
         ++outline;
         fprintf(code_file, "#define yyparse %sparse\n", symbol_prefix);
+        if (cxxflag)
+        {
+            outline += 3;
+            fprintf(code_file, "#define yyparser %sparser\n", symbol_prefix);
+            fprintf(code_file, "#define yybasic_tables %sbasic_tables\n",
+                    symbol_prefix);
+            fprintf(code_file, "#define yytables %stables\n", symbol_prefix);
+        }
         ++outline;
         fprintf(code_file, "#define yylex %slex\n", symbol_prefix);
         ++outline;
@@ -72,42 +169,204 @@ output_prefix()
         fprintf(code_file, "#define yyvs %svs\n", symbol_prefix);
         ++outline;
         fprintf(code_file, "#define yyvsp %svsp\n", symbol_prefix);
-        ++outline;
-        fprintf(code_file, "#define yylhs %slhs\n", symbol_prefix);
-        ++outline;
-        fprintf(code_file, "#define yylen %slen\n", symbol_prefix);
-        ++outline;
-        fprintf(code_file, "#define yydefred %sdefred\n", symbol_prefix);
-        ++outline;
-        fprintf(code_file, "#define yydgoto %sdgoto\n", symbol_prefix);
-        ++outline;
-        fprintf(code_file, "#define yysindex %ssindex\n", symbol_prefix);
-        ++outline;
-        fprintf(code_file, "#define yyrindex %srindex\n", symbol_prefix);
-        ++outline;
-        fprintf(code_file, "#define yygindex %sgindex\n", symbol_prefix);
-        ++outline;
-        fprintf(code_file, "#define yytable %stable\n", symbol_prefix);
-        ++outline;
-        fprintf(code_file, "#define yycheck %scheck\n", symbol_prefix);
-        ++outline;
-        fprintf(code_file, "#define yyname %sname\n", symbol_prefix);
-        ++outline;
-        fprintf(code_file, "#define yyrule %srule\n", symbol_prefix);
+        if (ctflag)
+        {
+            outline += 5;
+            fprintf(code_file, "#define yytables %stables\n", symbol_prefix);
+            fprintf(code_file, "#define yynames %snames\n", symbol_prefix);
+            fprintf(code_file, "#define yynameindex %snameindex\n",
+                    symbol_prefix);
+            fprintf(code_file, "#define yyrules %srules\n", symbol_prefix);
+            fprintf(code_file, "#define yyruleindex %sruleindex\n",
+                    symbol_prefix);
+        }
+        else
+        {
+            ++outline;
+            fprintf(code_file, "#define yylhs %slhs\n", symbol_prefix);
+            ++outline;
+            fprintf(code_file, "#define yylen %slen\n", symbol_prefix);
+            ++outline;
+            fprintf(code_file, "#define yydefred %sdefred\n", symbol_prefix);
+            ++outline;
+            fprintf(code_file, "#define yydgoto %sdgoto\n", symbol_prefix);
+            ++outline;
+            fprintf(code_file, "#define yysindex %ssindex\n", symbol_prefix);
+            ++outline;
+            fprintf(code_file, "#define yyrindex %srindex\n", symbol_prefix);
+            ++outline;
+            fprintf(code_file, "#define yygindex %sgindex\n", symbol_prefix);
+            ++outline;
+            fprintf(code_file, "#define yytable %stable\n", symbol_prefix);
+            ++outline;
+            fprintf(code_file, "#define yycheck %scheck\n", symbol_prefix);
+            ++outline;
+            fprintf(code_file, "#define yyerrdepth %serrdepth\n",
+                    symbol_prefix);
+            ++outline;
+            fprintf(code_file, "#define yytranslate %stranslate\n",
+                    symbol_prefix);
+            ++outline;
+            fprintf(code_file, "#define yyname %sname\n", symbol_prefix);
+            ++outline;
+            fprintf(code_file, "#define yyrule %srule\n", symbol_prefix);
+        }
+        outline += 3;
+        fprintf(code_file, "#define yyprofstates %sprofstates\n",
+                symbol_prefix);
+        fprintf(code_file, "#define yyproftokens %sproftokens\n",
+                symbol_prefix);
+        fprintf(code_file, "#define yyprofdump %sprofdump\n", symbol_prefix);
+        outline += 3;
+        fprintf(code_file, "#define yystats %sstats\n", symbol_prefix);
+        fprintf(code_file, "#define yystatshook %sstatshook\n", symbol_prefix);
+        fprintf(code_file, "#define yystatsdump %sstatsdump\n", symbol_prefix);
+        outline += 4;
+        fprintf(code_file, "#define yytracebuf %stracebuf\n", symbol_prefix);
+        fprintf(code_file, "#define yytracepos %stracepos\n", symbol_prefix);
+        fprintf(code_file, "#define yytracedump %stracedump\n", symbol_prefix);
+        fprintf(code_file, "#define yytracedecode %stracedecode\n",
+                symbol_prefix);
+        outline += 2;
+        fprintf(code_file, "#define yysteps %ssteps\n", symbol_prefix);
+        fprintf(code_file, "#define yydeadline %sdeadline\n", symbol_prefix);
+        outline += 3;
+        fprintf(code_file, "#define yyexpect %sexpect\n", symbol_prefix);
+        fprintf(code_file, "#define yyexprow %sexprow\n", symbol_prefix);
+        fprintf(code_file, "#define yyexpected %sexpected\n", symbol_prefix);
+        if (itflag)
+        {
+            outline += 2;
+            fprintf(code_file, "#define yystaterecs %sstaterecs\n",
+                    symbol_prefix);
+            fprintf(code_file, "#define yypairs %spairs\n", symbol_prefix);
+        }
+        if (tsflag)
+        {
+            outline += 3;
+            fprintf(code_file, "#define yyvsize %svsize\n", symbol_prefix);
+            fprintf(code_file, "#define yyvlen %svlen\n", symbol_prefix);
+            fprintf(code_file, "#define yyvfirst %svfirst\n", symbol_prefix);
+        }
+        if (reflag)
+        {
+            outline += 8;
+            fprintf(code_file, "#define yyhandle %shandle\n", symbol_prefix);
+            fprintf(code_file, "#define yysnapshot %ssnapshot\n",
+                    symbol_prefix);
+            fprintf(code_file, "#define yyparse_snapshot %sparse_snapshot\n",
+                    symbol_prefix);
+            fprintf(code_file, "#define yyparse_restore %sparse_restore\n",
+                    symbol_prefix);
+            fprintf(code_file, "#define yyparse_release %sparse_release\n",
+                    symbol_prefix);
+            outline += 3;
+            fprintf(code_file, "#define yycheckpoint %scheckpoint\n",
+                    symbol_prefix);
+            fprintf(code_file, "#define yyparse_checkpoints %sparse_checkpoints\n",
+                    symbol_prefix);
+            fprintf(code_file, "#define yyparse_edit %sparse_edit\n",
+                    symbol_prefix);
+            fprintf(code_file, "#define yyparse_init %sparse_init\n",
+                    symbol_prefix);
+            fprintf(code_file, "#define yyparse_reset %sparse_reset\n",
+                    symbol_prefix);
+            outline += 2;
+            fprintf(code_file, "#define yyparse_alloc %sparse_alloc\n",
+                    symbol_prefix);
+            fprintf(code_file, "#define yyparse_free %sparse_free\n",
+                    symbol_prefix);
+            fprintf(code_file, "#define yyparse_batch %sparse_batch\n",
+                    symbol_prefix);
+            ++outline;
+            fprintf(code_file, "#define yyparse_budget %sparse_budget\n",
+                    symbol_prefix);
+            outline += 2;
+            fprintf(code_file, "#define yysynctokens %ssynctokens\n",
+                    symbol_prefix);
+            fprintf(code_file, "#define yyparse_chunks %sparse_chunks\n",
+                    symbol_prefix);
+        }
     }
     ++outline;
     fprintf(code_file, "#define YYPREFIX \"%s\"\n", symbol_prefix);
 }
 
 
+/**
+*   @brief Starts the initializer of a table
+*
+*   With --const-tables the tables are not separate arrays but consecutive slices of the single read-only array
+*   yytables, which needs no relocation and can be shared by all the processes running the parser. The name of the
+*   table is then #defined in the code file as the address of its slice.
+*
+*   @param[in] name  The name of the table, without the symbol prefix
+*   @param[in] size  The number of entries of the table
+*   @param[in] width The field width of the first entry, which aligns it with the following lines
+*   @param[in] value The first entry of the table
+*/
+start_table(name, size, width, value)
+char *name;
+int size;
+int width;
+int value;
+{
+    if (!ctflag)
+    {
+        fprintf(output_file, "%sshort %s%s[] = {%*d,", storage, symbol_prefix,
+                name, width, value);
+        return;
+    }
+
+    ++outline;
+    fprintf(code_file, "#define yy%s (%stables + %d)\n", name, symbol_prefix,
+            table_offset);
+    if (table_offset == 0)
+    {
+        if (!rflag) ++outline;
+        fprintf(output_file, "const short %stables[] = {\n", symbol_prefix);
+    }
+    fprintf(output_file, "/* %s%s */%*d,", symbol_prefix, name, width + 6,
+            value);
+    table_offset += size;
+}
+
+
+/**
+*   @brief Ends the initializer of a table started by start_table()
+*/
+end_table()
+{
+    if (ctflag)
+    {
+        if (!rflag) ++outline;
+        putc('\n', output_file);
+    }
+    else
+    {
+        if (!rflag) outline += 2;
+        fprintf(output_file, "\n};\n");
+    }
+}
+
+
+/**
+*   @brief Closes the array yytables after the last table (--const-tables)
+*/
+end_const_tables()
+{
+    if (!rflag) ++outline;
+    fprintf(output_file, "};\n");
+}
+
+
 output_rule_data()
 {
     register int i;
     register int j;
 
   
-    fprintf(output_file, "short %slhs[] = {%42d,", symbol_prefix,
-            symbol_value[start_symbol]);
+    start_table("lhs", nrules - 2, 42, symbol_value[start_symbol]);
 
     j = 10;
     for (i = 3; i < nrules; i++)
@@ -123,10 +382,9 @@ output_rule_data()
 
         fprintf(output_file, "%5d,", symbol_value[rlhs[i]]);
     }
-    if (!rflag) outline += 2;
-    fprintf(output_file, "\n};\n");
+    end_table();
 
-    fprintf(output_file, "short %slen[] = {%42d,", symbol_prefix, 2);
+    start_table("len", nrules - 2, 42, 2);
 
     j = 10;
     for (i = 3; i < nrules; i++)
@@ -142,8 +400,26 @@ output_rule_data()
 
         fprintf(output_file, "%5d,", rrhs[i + 1] - rrhs[i] - 1);
     }
-    if (!rflag) outline += 2;
-    fprintf(output_file, "\n};\n");
+    end_table();
+}
+
+
+/**
+*   @brief Returns the entry of yydefred for a state
+*
+*   A positive entry is a reduction that the parser makes without reading a token. A negative entry, which only
+*   --default-reductions=most-common produces, is a reduction that it makes for the tokens that the tables do not
+*   list, instead of detecting an error.
+*/
+int
+defred_entry(state)
+int state;
+{
+    if (defred[state] == 0)
+        return (0);
+    if (immediate_reduction(state))
+        return (defred[state] - 2);
+    return (2 - defred[state]);
 }
 
 
@@ -151,8 +427,7 @@ output_yydefred()
 {
     register int i, j;
 
-    fprintf(output_file, "short %sdefred[] = {%39d,", symbol_prefix,
-            (defred[0] ? defred[0] - 2 : 0));
+    start_table("defred", nstates, 39, defred_entry(0));
 
     j = 10;
     for (i = 1; i < nstates; i++)
@@ -166,11 +441,10 @@ output_yydefred()
             j = 1;
         }
 
-        fprintf(output_file, "%5d,", (defred[i] ? defred[i] - 2 : 0));
+        fprintf(output_file, "%5d,", defred_entry(i));
     }
 
-    if (!rflag) outline += 2;
-    fprintf(output_file, "\n};\n");
+    end_table();
 }
 
 
@@ -184,21 +458,29 @@ output_actions()
     width = NEW2(nvectors, short);
 
     token_actions();
+    if (tcflag) output_translate();
     FREE(lookaheads);
     FREE(LA);
     FREE(LAruleno);
-    FREE(accessing_symbol);
+    if (!tsflag) FREE(accessing_symbol);
 
     goto_actions();
+    if (!cxxflag) output_error_depths();
     FREE(goto_map + ntokens);
     FREE(from_state);
     FREE(to_state);
 
     sort_actions();
     pack_table();
-    output_base();
-    output_table();
-    output_check();
+    if (itflag)
+        output_interleaved();
+    else
+    {
+        output_base();
+        output_table();
+        output_check();
+        if (ctflag) end_const_tables();
+    }
 }
 
 
@@ -209,6 +491,23 @@ token_actions()
     register int max, min;
     register short *actionrow, *r, *s;
     register action *p;
+    register short *value;
+    char *skip, *seen;
+
+    /*  With token classes, only the first token of each class has entries, in the column of its class  */
+    value = symbol_value;
+    skip = NEW2(ntokens, char);
+    if (tcflag)
+    {
+        value = token_class;
+        seen = NEW2(nclasses, char);
+        for (i = 0; i < ntokens; ++i)
+        {
+            skip[i] = seen[token_class[i]];
+            seen[token_class[i]] = 1;
+        }
+        FREE(seen);
+    }
 
     actionrow = NEW2(2*ntokens, short);
     for (i = 0; i < nstates; ++i)
@@ -222,7 +521,7 @@ token_actions()
             reducecount = 0;
             for (p = parser[i]; p; p = p->next)
             {
-                if (p->suppressed == 0)
+                if (p->suppressed == 0 && !skip[p->symbol])
                 {
                     if (p->action_code == SHIFT)
                     {
@@ -251,11 +550,11 @@ token_actions()
                 {
                     if (actionrow[j])
                     {
-                        if (min > symbol_value[j])
-                            min = symbol_value[j];
-                        if (max < symbol_value[j])
-                            max = symbol_value[j];
-                        *r++ = symbol_value[j];
+                        if (min > value[j])
+                            min = value[j];
+                        if (max < value[j])
+                            max = value[j];
+                        *r++ = value[j];
                         *s++ = actionrow[j];
                     }
                 }
@@ -271,11 +570,11 @@ token_actions()
                 {
                     if (actionrow[ntokens+j])
                     {
-                        if (min > symbol_value[j])
-                            min = symbol_value[j];
-                        if (max < symbol_value[j])
-                            max = symbol_value[j];
-                        *r++ = symbol_value[j];
+                        if (min > value[j])
+                            min = value[j];
+                        if (max < value[j])
+                            max = value[j];
+                        *r++ = value[j];
                         *s++ = actionrow[ntokens+j] - 2;
                     }
                 }
@@ -284,6 +583,7 @@ token_actions()
         }
     }
     FREE(actionrow);
+    FREE(skip);
 }
 
 goto_actions()
@@ -293,7 +593,7 @@ goto_actions()
     state_count = NEW2(nstates, short);
 
     k = default_goto(start_symbol + 1);
-    fprintf(output_file, "short %sdgoto[] = {%40d,", symbol_prefix, k);
+    start_table("dgoto", nvars - 1, 40, k);
     save_column(start_symbol + 1, k);
 
     j = 10;
@@ -313,11 +613,243 @@ goto_actions()
         save_column(i, k);
     }
 
-    if (!rflag) outline += 2;
-    fprintf(output_file, "\n};\n");
+    end_table();
     FREE(state_count);
 }
 
+/**
+*   @brief Writes yyerrdepth, the least number of states that error recovery must pop in each state
+*
+*   The entry of a state is 0 if it shifts the error token, and otherwise the length of the shortest path of
+*   transitions to it from a state that does, since every state below it on the stack is the start of such a path.
+*   The parser can therefore pop that many states without looking them up in yysindex, and abort at once if the
+*   stack is not as deep, which it is never for the states that no path reaches (MAXSHORT).
+*/
+output_error_depths()
+{
+    register int i, j, k, s;
+    register action *p;
+    short *depth, *queue, *first, *next;
+    int head, tail;
+
+    depth = NEW2(nstates, short);
+    queue = NEW2(nstates, short);
+    first = NEW2(nstates + 1, short);
+    next = NEW2(goto_map[nsyms] + 1, short);
+
+    /*  Thread the gotos of every state into a list, which goto_map orders by symbol  */
+    for (i = 0; i < nstates; ++i)
+        first[i] = -1;
+    for (k = 0; k < goto_map[nsyms]; ++k)
+    {
+        next[k] = first[from_state[k]];
+        first[from_state[k]] = k;
+    }
+
+    tail = 0;
+    for (i = 0; i < nstates; ++i)
+    {
+        depth[i] = MAXSHORT;
+        for (p = parser[i]; p; p = p->next)
+        {
+            if (p->symbol == 1 && p->action_code == SHIFT && p->suppressed == 0)
+            {
+                depth[i] = 0;
+                queue[tail++] = i;
+                break;
+            }
+        }
+    }
+
+    for (head = 0; head < tail; ++head)
+    {
+        s = queue[head];
+        for (p = parser[s]; p; p = p->next)
+        {
+            if (p->action_code == SHIFT && p->suppressed == 0 &&
+                    depth[p->number] == MAXSHORT)
+            {
+                depth[p->number] = depth[s] + 1;
+                queue[tail++] = p->number;
+            }
+        }
+        for (k = first[s]; k >= 0; k = next[k])
+        {
+            if (depth[to_state[k]] == MAXSHORT)
+            {
+                depth[to_state[k]] = depth[s] + 1;
+                queue[tail++] = to_state[k];
+            }
+        }
+    }
+
+    start_table("errdepth", nstates, 37, depth[0]);
+    j = 10;
+    for (i = 1; i < nstates; i++)
+    {
+        if (j < 10)
+            ++j;
+        else
+        {
+            if (!rflag) ++outline;
+            putc('\n', output_file);
+            j = 1;
+        }
+
+        fprintf(output_file, "%5d,", depth[i]);
+    }
+    end_table();
+
+    FREE(depth);
+    FREE(queue);
+    FREE(first);
+    FREE(next);
+}
+
+
+/**
+*   @brief Writes, for each state, the set of tokens that have an action in it
+*
+*   The sets are bitmaps indexed by token value, of which yyexpect holds each distinct one once and yyexprow gives the
+*   row of each state, so that yyexpected() can list the tokens that the parser expected when it found a syntax
+*   error without trying every token against the packed tables. The error token is not part of the sets.
+*/
+output_expected()
+{
+    register int i, j, k, n;
+    register action *p;
+    register unsigned char *bits;
+    int nbytes, nrows, maxtoken;
+    short *row;
+    unsigned *hash;
+
+    maxtoken = 0;
+    for (i = 2; i < ntokens; ++i)
+        if (symbol_value[i] > maxtoken)
+            maxtoken = symbol_value[i];
+    nbytes = maxtoken / 8 + 1;
+
+    bits = NEW2(nstates * nbytes, unsigned char);
+    row = NEW2(nstates, short);
+    hash = NEW2(nstates, unsigned);
+
+    outline += 2;
+    fprintf(code_file, "#if YYEXPECTED\n#define YYEXPECTBYTES %d\n", nbytes);
+    fprintf(code_file, "unsigned char yyexpect[][YYEXPECTBYTES] = {");
+    nrows = 0;
+    for (i = 0; i < nstates; ++i)
+    {
+        k = nrows * nbytes;
+        for (j = 0; j < nbytes; ++j)
+            bits[k + j] = 0;
+        for (p = parser[i]; p; p = p->next)
+        {
+            if (p->symbol != 1 && p->suppressed == 0 &&
+                    (p->action_code == SHIFT || p->action_code == REDUCE))
+            {
+                n = symbol_value[p->symbol];
+                bits[k + n / 8] |= 1 << (n % 8);
+            }
+        }
+
+        hash[nrows] = 0;
+        for (j = 0; j < nbytes; ++j)
+            hash[nrows] = hash[nrows] * 31 + bits[k + j];
+        for (n = 0; n < nrows; ++n)
+        {
+            if (hash[n] != hash[nrows]) continue;
+            for (j = 0; j < nbytes && bits[n * nbytes + j] == bits[k + j]; ++j)
+                continue;
+            if (j == nbytes) break;
+        }
+        row[i] = n;
+        if (n < nrows) continue;
+
+        ++nrows;
+        ++outline;
+        fprintf(code_file, "\n{");
+        for (j = 0; j < nbytes; ++j)
+        {
+            if (j > 0 && j % 12 == 0)
+            {
+                ++outline;
+                putc('\n', code_file);
+            }
+            fprintf(code_file, "%d,", bits[k + j]);
+        }
+        putc('}', code_file);
+        putc(',', code_file);
+    }
+    outline += 2;
+    fprintf(code_file, "\n};\nshort yyexprow[] = {");
+
+    j = 10;
+    for (i = 0; i < nstates; ++i)
+    {
+        if (j >= 10)
+        {
+            ++outline;
+            putc('\n', code_file);
+            j = 1;
+        }
+        else
+            ++j;
+
+        fprintf(code_file, "%5d,", row[i]);
+    }
+    outline += 3;
+    fprintf(code_file, "\n};\n#endif\n");
+
+    FREE(bits);
+    FREE(row);
+    FREE(hash);
+}
+
+
+/**
+*   @brief Writes yytranslate, the class of each token value (--token-classes)
+*
+*   The columns of the action tables are classes of tokens rather than token values, so that the tokens that act
+*   alike in every state share one column and the sparse token numbers leave no gaps. Values that name no token map
+*   to class 0, which has no entries, and the parser maps the values above YYMAXTOKEN to it as well.
+*/
+output_translate()
+{
+    register int i, j, max;
+    short *class;
+
+    max = 0;
+    for (i = 2; i < ntokens; ++i)
+        if (symbol_value[i] > max)
+            max = symbol_value[i];
+    class = NEW2(max + 1, short);
+    for (i = 0; i < ntokens; ++i)
+        class[symbol_value[i]] = token_class[i];
+
+    outline += 3;
+    fprintf(code_file, "#define YYTOKENCLASSES 1\n#define YYNCLASSES %d\n\
+#define YYERRCLASS %d\n", nclasses, token_class[1]);
+
+    start_table("translate", max + 1, 36, class[0]);
+    j = 10;
+    for (i = 1; i <= max; i++)
+    {
+        if (j < 10)
+            ++j;
+        else
+        {
+            if (!rflag) ++outline;
+            putc('\n', output_file);
+            j = 1;
+        }
+
+        fprintf(output_file, "%5d,", class[i]);
+    }
+    end_table();
+    FREE(class);
+}
+
+
 int
 default_goto(symbol)
 int symbol;
@@ -397,6 +929,10 @@ int default_state;
     width[symno] = sp1[-1] - sp[0] + 1;
 }
 
+/*  With --profile, the rows of the action tables are sorted by        */
+/*  decreasing weight first, so that the rows used most often are      */
+/*  packed together at the beginning of yytable.                        */
+
 sort_actions()
 {
     register int i;
@@ -404,6 +940,7 @@ sort_actions()
     register int k;
     register int t;
     register int w;
+    register long h;
 
     order = NEW2(nvectors, short);
     nentries = 0;
@@ -414,12 +951,18 @@ sort_actions()
         {
             t = tally[i];
             w = width[i];
+            h = vector_weight(i);
             j = nentries - 1;
 
-            while (j >= 0 && (width[order[j]] < w))
+            while (j >= 0 && vector_weight(order[j]) < h)
+                j--;
+
+            while (j >= 0 && vector_weight(order[j]) == h &&
+                    (width[order[j]] < w))
                 j--;
 
-            while (j >= 0 && (width[order[j]] == w) && (tally[order[j]] < t))
+            while (j >= 0 && vector_weight(order[j]) == h &&
+                    (width[order[j]] == w) && (tally[order[j]] < t))
                 j--;
 
             for (k = nentries - 1; k > j; k--)
@@ -432,6 +975,14 @@ sort_actions()
 }
 
 
+long
+vector_weight(i)
+int i;
+{
+    return (row_weight && i < 2*nstates ? row_weight[i] : 0);
+}
+
+
 pack_table()
 {
     register int i;
@@ -617,7 +1168,7 @@ output_base()
 {
     register int i, j;
 
-    fprintf(output_file, "short %ssindex[] = {%39d,", symbol_prefix, base[0]);
+    start_table("sindex", nstates, 39, base[0]);
 
     j = 10;
     for (i = 1; i < nstates; i++)
@@ -634,9 +1185,8 @@ output_base()
         fprintf(output_file, "%5d,", base[i]);
     }
 
-    if (!rflag) outline += 2;
-    fprintf(output_file, "\n};\nshort %srindex[] = {%39d,", symbol_prefix,
-            base[nstates]);
+    end_table();
+    start_table("rindex", nstates, 39, base[nstates]);
 
     j = 10;
     for (i = nstates + 1; i < 2*nstates; i++)
@@ -653,9 +1203,8 @@ output_base()
         fprintf(output_file, "%5d,", base[i]);
     }
 
-    if (!rflag) outline += 2;
-    fprintf(output_file, "\n};\nshort %sgindex[] = {%39d,", symbol_prefix,
-            base[2*nstates]);
+    end_table();
+    start_table("gindex", nvars - 1, 39, base[2*nstates]);
 
     j = 10;
     for (i = 2*nstates + 1; i < nvectors - 1; i++)
@@ -672,8 +1221,7 @@ output_base()
         fprintf(output_file, "%5d,", base[i]);
     }
 
-    if (!rflag) outline += 2;
-    fprintf(output_file, "\n};\n");
+    end_table();
     FREE(base);
 }
 
@@ -686,8 +1234,7 @@ output_table()
 
     ++outline;
     fprintf(code_file, "#define YYTABLESIZE %d\n", high);
-    fprintf(output_file, "short %stable[] = {%40d,", symbol_prefix,
-            table[0]);
+    start_table("table", high + 1, 40, table[0]);
 
     j = 10;
     for (i = 1; i <= high; i++)
@@ -704,8 +1251,7 @@ output_table()
         fprintf(output_file, "%5d,", table[i]);
     }
 
-    if (!rflag) outline += 2;
-    fprintf(output_file, "\n};\n");
+    end_table();
     FREE(table);
 }
 
@@ -716,8 +1262,7 @@ output_check()
     register int i;
     register int j;
 
-    fprintf(output_file, "short %scheck[] = {%40d,", symbol_prefix,
-            check[0]);
+    start_table("check", high + 1, 40, check[0]);
 
     j = 10;
     for (i = 1; i <= high; i++)
@@ -734,24 +1279,134 @@ output_check()
         fprintf(output_file, "%5d,", check[i]);
     }
 
-    if (!rflag) outline += 2;
-    fprintf(output_file, "\n};\n");
+    end_table();
     FREE(check);
 }
 
 
-int
-is_C_identifier(name)
-char *name;
+/**
+*   @brief Writes the tables in the interleaved layout (--interleaved-tables)
+*
+*   The entries of yydefred, yysindex and yyrindex for a state are gathered in one record of yystaterecs, and the
+*   entries of yycheck and yytable at the same index in one pair of yypairs, so that the parser touches two cache
+*   lines per token instead of five. The bases are shifted so that none is negative, and yypairs is padded with
+*   unmatchable entries up to the largest index that a base plus a token number (YYMAXTOKEN + 1 stands for all the
+*   illegal tokens) or a state number can reach, so that the parser does not need to check the bounds of the index.
+*   yygindex remains a separate table, written last so that it can still be part of yytables with --const-tables.
+*/
+output_interleaved()
 {
-    register char *s;
-    register int c;
+    register int i, j, k;
+    register int pad, size, maxtoken;
+    char *types;
 
-    s = name;
-    c = *s;
-    if (c == '"')
-    {
-        c = *++s;
+    maxtoken = 0;
+    for (i = 2; i < ntokens; ++i)
+        if (symbol_value[i] > maxtoken)
+            maxtoken = symbol_value[i];
+
+    k = 0;
+    for (i = 0; i < nvectors - 1; ++i)
+        if (base[i] < k) k = base[i];
+    pad = k < 0 ? 1 - k : 0;
+
+    size = high + pad + 1;
+    for (i = 0; i < nvectors - 1; ++i)
+    {
+        if (base[i])
+        {
+            base[i] += pad;
+            if (i >= 2*nstates)
+                k = base[i] + nstates - 1;
+            else
+                k = base[i] + (tcflag ? nclasses - 1 : maxtoken + 1);
+            if (k >= size) size = k + 1;
+        }
+    }
+
+    start_table("gindex", nvars - 1, 39, base[2*nstates]);
+    j = 10;
+    for (i = 2*nstates + 1; i < nvectors - 1; i++)
+    {
+        if (j >= 10)
+        {
+            if (!rflag) ++outline;
+            putc('\n', output_file);
+            j = 1;
+        }
+        else
+            ++j;
+
+        fprintf(output_file, "%5d,", base[i]);
+    }
+    end_table();
+    if (ctflag) end_const_tables();
+
+    types = "struct yystaterec { short defred, sindex, rindex; };\n\
+struct yypair { short check, value; };\n";
+    outline += 4;
+    fprintf(code_file, "#define YYINTERLEAVED 1\n#define YYTABLESIZE %d\n%s",
+            size - 1, types);
+    if (rflag)
+    {
+        fprintf(output_file, "%s", types);
+        outline += 2;
+        fprintf(code_file, "extern %sstruct yystaterec yystaterecs[];\n\
+extern %sstruct yypair yypairs[];\n", storage, storage);
+    }
+
+    fprintf(output_file, "%sstruct yystaterec %sstaterecs[] = {", storage,
+            symbol_prefix);
+    for (i = 0; i < nstates; i++)
+    {
+        if (!rflag) ++outline;
+        fprintf(output_file, "\n{%5d,%5d,%5d},",
+                defred_entry(i), base[i], base[nstates + i]);
+    }
+    if (!rflag) outline += 2;
+    fprintf(output_file, "\n};\n");
+
+    fprintf(output_file, "%sstruct yypair %spairs[] = {", storage,
+            symbol_prefix);
+    j = 5;
+    for (i = 0; i < size; i++)
+    {
+        if (j >= 5)
+        {
+            if (!rflag) ++outline;
+            putc('\n', output_file);
+            j = 1;
+        }
+        else
+            ++j;
+
+        k = i - pad;
+        if (k >= 0 && k <= high)
+            fprintf(output_file, "{%5d,%5d},", check[k], table[k]);
+        else
+            fprintf(output_file, "{%5d,%5d},", -1, 0);
+    }
+    if (!rflag) outline += 2;
+    fprintf(output_file, "\n};\n");
+
+    FREE(base);
+    FREE(table);
+    FREE(check);
+}
+
+
+int
+is_C_identifier(name)
+char *name;
+{
+    register char *s;
+    register int c;
+
+    s = name;
+    c = *s;
+    if (c == '"')
+    {
+        c = *++s;
         if (!isalpha(c) && c != '_' && c != '$')
             return (0);
         while ((c = *++s) != '"')
@@ -811,6 +1466,18 @@ output_defines()
 
     ++outline;
     fprintf(code_file, "#define YYERRCODE %d\n", symbol_value[1]);
+    if (ipflag)
+    {
+        ++outline;
+        fprintf(code_file, "#define YYLEXINPLACE 1\n");
+        if (dflag) fprintf(defines_file, "#define YYLEXINPLACE 1\n");
+    }
+    if (reflag)
+    {
+        ++outline;
+        fprintf(code_file, "#define YYREENTRANT 1\n");
+        if (dflag) output_handle_api();
+    }
 
     if (dflag && unionized)
     {
@@ -819,12 +1486,46 @@ output_defines()
         if (union_file == NULL) open_error(union_file_name);
         while ((c = getc(union_file)) != EOF)
             putc(c, defines_file);
-        fprintf(defines_file, " YYSTYPE;\nextern YYSTYPE %slval;\n",
-                symbol_prefix);
+        if (cxxflag)
+            fprintf(defines_file, " YYSTYPE;\n");
+        else if (reflag)
+            fprintf(defines_file,
+                    " YYSTYPE;\nextern int %slex(YYSTYPE *, void *);\n",
+                    symbol_prefix);
+        else if (ipflag)
+            fprintf(defines_file, " YYSTYPE;\nextern int %slex(YYSTYPE *);\n",
+                    symbol_prefix);
+        else
+            fprintf(defines_file, " YYSTYPE;\nextern YYSTYPE %slval;\n",
+                    symbol_prefix);
     }
 }
 
 
+/**
+*   @brief Declares the handle of a reentrant parser in the defines file
+*
+*   struct yyhandle is only declared, as its layout depends on macros that the other files need not define; a
+*   handle for them is allocated by yyparse_alloc and freed by yyparse_free.
+*/
+output_handle_api()
+{
+    register char *p = symbol_prefix;
+
+    fprintf(defines_file, "#define YYREENTRANT 1\n");
+    fprintf(defines_file, "struct %shandle;\n", p);
+    fprintf(defines_file, "extern struct %shandle *%sparse_alloc(void *);\n",
+            p, p);
+    fprintf(defines_file, "extern void %sparse_free(struct %shandle *);\n",
+            p, p);
+    fprintf(defines_file,
+            "extern void %sparse_init(struct %shandle *, void *);\n", p, p);
+    fprintf(defines_file,
+            "extern void %sparse_reset(struct %shandle *, void *);\n", p, p);
+    fprintf(defines_file, "extern int %sparse(struct %shandle *);\n", p, p);
+}
+
+
 output_stored_text()
 {
     register int c;
@@ -855,10 +1556,15 @@ output_stored_text()
 output_debug()
 {
     register int i, j, k, max;
-    char **symnam, *s;
+    char **symnam, *s, *end;
+    int *offsets;
 
     ++outline;
     fprintf(code_file, "#define YYFINAL %d\n", final_state);
+    ++outline;
+    fprintf(code_file, "#define YYNSTATES %d\n", nstates);
+    ++outline;
+    fprintf(code_file, "#define YYNRULES %d\n", nrules - 2);
     outline += 3;
     fprintf(code_file, "#ifndef YYDEBUG\n#define YYDEBUG %d\n#endif\n",
             tflag);
@@ -872,6 +1578,20 @@ output_debug()
             max = symbol_value[i];
     ++outline;
     fprintf(code_file, "#define YYMAXTOKEN %d\n", max);
+    if (ctflag)
+    {
+        outline += 3;
+        fprintf(code_file, "#define YYNAME(i) (yynameindex[i] < 0 ? \
+(char *) 0 : \\\n\t\t\t(char *) yynames + yynameindex[i])\n");
+        fprintf(code_file,
+                "#define YYRULE(i) ((char *) yyrules + yyruleindex[i])\n");
+    }
+    else if (!cxxflag)
+    {
+        outline += 2;
+        fprintf(code_file, "#define YYNAME(i) yyname[i]\n");
+        fprintf(code_file, "#define YYRULE(i) yyrule[i]\n");
+    }
 
     symnam = (char **) MALLOC((max+1)*sizeof(char *));
     if (symnam == 0) no_space();
@@ -884,8 +1604,22 @@ output_debug()
         symnam[symbol_value[i]] = symbol_name[i];
     symnam[0] = "end-of-file";
 
+    /* With --const-tables, the names are written as a single string     */
+    /* blob, and yynameindex gives the offset of each name in the blob.  */
+
     if (!rflag) ++outline;
-    fprintf(output_file, "#if YYDEBUG\nchar *%sname[] = {", symbol_prefix);
+    if (ctflag)
+    {
+        end = "\\0\"";
+        fprintf(output_file, "#if YYDEBUG\nconst char %snames[] =",
+                symbol_prefix);
+    }
+    else
+    {
+        end = "\",";
+        fprintf(output_file, "#if YYDEBUG\n%s%schar *%sname[] = {", storage,
+                cxxflag ? "const " : "", symbol_prefix);
+    }
     j = 80;
     for (i = 0; i <= max; ++i)
     {
@@ -926,7 +1660,7 @@ output_debug()
                     else
                         putc(*s, output_file);
                 }
-                fprintf(output_file, "\\\"\",");
+                fprintf(output_file, "\\\"%s", end);
             }
             else if (s[0] == '\'')
             {
@@ -939,7 +1673,7 @@ output_debug()
                         putc('\n', output_file);
                         j = 7;
                     }
-                    fprintf(output_file, "\"'\\\"'\",");
+                    fprintf(output_file, "\"'\\\"'%s", end);
                 }
                 else
                 {
@@ -976,7 +1710,7 @@ output_debug()
                         else
                             putc(*s, output_file);
                     }
-                    fprintf(output_file, "'\",");
+                    fprintf(output_file, "'%s", end);
                 }
             }
             else
@@ -991,10 +1725,10 @@ output_debug()
                 }
                 putc('"', output_file);
                 do { putc(*s, output_file); } while (*++s);
-                fprintf(output_file, "\",");
+                fprintf(output_file, "%s", end);
             }
         }
-        else
+        else if (!ctflag)
         {
             j += 2;
             if (j > 80)
@@ -1006,12 +1740,45 @@ output_debug()
             fprintf(output_file, "0,");
         }
     }
-    if (!rflag) outline += 2;
-    fprintf(output_file, "\n};\n");
+    if (ctflag)
+    {
+        if (!rflag) ++outline;
+        fprintf(output_file, ";\n");
+
+        offsets = NEW2(max + 1, int);
+        k = 0;
+        for (i = 0; i <= max; ++i)
+        {
+            if (symnam[i])
+            {
+                offsets[i] = k;
+                k += strlen(symnam[i]) + 1;
+            }
+            else
+                offsets[i] = -1;
+        }
+        output_offset_table("nameindex", max + 1, offsets);
+        FREE(offsets);
+    }
+    else
+    {
+        if (!rflag) outline += 2;
+        fprintf(output_file, "\n};\n");
+    }
     FREE(symnam);
 
     if (!rflag) ++outline;
-    fprintf(output_file, "char *%srule[] = {\n", symbol_prefix);
+    if (ctflag)
+    {
+        end = "\\0\"\n";
+        fprintf(output_file, "const char %srules[] =\n", symbol_prefix);
+    }
+    else
+    {
+        end = "\",\n";
+        fprintf(output_file, "%s%schar *%srule[] = {\n", storage,
+                cxxflag ? "const " : "", symbol_prefix);
+    }
     for (i = 2; i < nrules; ++i)
     {
         fprintf(output_file, "\"%s :", symbol_name[rlhs[i]]);
@@ -1058,11 +1825,182 @@ output_debug()
                 fprintf(output_file, " %s", s);
         }
         if (!rflag) ++outline;
-        fprintf(output_file, "\",\n");
+        fprintf(output_file, "%s", end);
+    }
+
+    if (ctflag)
+    {
+        if (!rflag) ++outline;
+        fprintf(output_file, ";\n");
+
+        offsets = NEW2(nrules - 2, int);
+        k = 0;
+        for (i = 2; i < nrules; ++i)
+        {
+            offsets[i - 2] = k;
+            k += strlen(symbol_name[rlhs[i]]) + 3;
+            for (j = rrhs[i]; ritem[j] > 0; ++j)
+                k += strlen(symbol_name[ritem[j]]) + 1;
+        }
+        output_offset_table("ruleindex", nrules - 2, offsets);
+        FREE(offsets);
+
+        if (!rflag) ++outline;
+        fprintf(output_file, "#endif\n");
+    }
+    else
+    {
+        if (!rflag) outline += 2;
+        fprintf(output_file, "};\n#endif\n");
+    }
+}
+
+
+/**
+*   @brief Writes the numbers that the states had before --profile renumbered them
+*
+*   yyprofdump() uses them, so that a parser generated with a profile writes profiles that can be used again.
+*/
+output_canonical()
+{
+    register int i, j;
+
+    ++outline;
+    fprintf(code_file, "#if YYPROFILE\nstatic short yycanonical[] = {");
+    j = 10;
+    for (i = 0; i < nstates; i++)
+    {
+        if (j >= 10)
+        {
+            ++outline;
+            putc('\n', code_file);
+            j = 1;
+        }
+        else
+            ++j;
+
+        fprintf(code_file, "%5d,", canonical_state[i]);
+    }
+    outline += 4;
+    fprintf(code_file, "\n};\n#define YYCANONICAL(s) yycanonical[s]\n\
+#endif\n");
+}
+
+
+/**
+*   @brief Writes the values of the restart-safe tokens found by find_sync_tokens(), ending with 0
+*
+*   After the parser shifts one of these tokens, it returns to the state YYFINAL at the bottom of the stack before
+*   it reads the next token, so yyparse_chunks() can start parsing there.
+*/
+output_sync()
+{
+    register int i, j;
+
+    fprintf(code_file, "short yysynctokens[] = {");
+    j = 10;
+    for (i = 2; i < ntokens; i++)
+    {
+        if (!sync_token[i]) continue;
+        if (j >= 10)
+        {
+            ++outline;
+            putc('\n', code_file);
+            j = 1;
+        }
+        else
+            ++j;
+
+        fprintf(code_file, "%5d,", symbol_value[i]);
+    }
+    outline += 3;
+    fprintf(code_file, "\n    0\n};\n");
+}
+
+
+/**
+*   @brief Writes a table of offsets in a string blob (--const-tables)
+*
+*   @param[in] name    The name of the table, without the symbol prefix
+*   @param[in] n       The number of entries of the table
+*   @param[in] offsets The entries of the table
+*/
+output_offset_table(name, n, offsets)
+char *name;
+int n;
+int *offsets;
+{
+    register int i, j;
+
+    fprintf(output_file, "const int %s%s[] = {", symbol_prefix, name);
+    j = 10;
+    for (i = 0; i < n; i++)
+    {
+        if (j >= 10)
+        {
+            if (!rflag) ++outline;
+            putc('\n', output_file);
+            j = 1;
+        }
+        else
+            ++j;
+
+        fprintf(output_file, "%5d,", offsets[i]);
     }
 
     if (!rflag) outline += 2;
-    fprintf(output_file, "};\n#endif\n");
+    fprintf(output_file, "\n};\n");
+}
+
+
+/**
+*   @brief Opens the structure that holds the tables of a C++ parser
+*
+*   With -x c++ the tables are written as constexpr static members of the class template yybasic_tables, so that
+*   they can be defined in a header file, and the parser class yyparser takes the instance yytables as a template
+*   argument (see cxx_header in skeleton.c). The template argument of yybasic_tables is only there because, before
+*   C++17, only the static members of templates can be defined in a header file that is included more than once.
+*/
+begin_tables_struct()
+{
+    outline += 4;
+    fprintf(output_file, "template <int N = 0>\nstruct %sbasic_tables\n{\n\
+    static constexpr int yyerrcode = YYERRCODE;\n", symbol_prefix);
+}
+
+
+/**
+*   @brief Closes the structure opened by begin_tables_struct()
+*
+*   The compile-time constants of the tables are added to the structure, then the tables are defined outside of it.
+*/
+end_tables_struct()
+{
+    static char *names[] =
+    {
+        "lhs", "len", "defred", "dgoto", "sindex", "rindex", "gindex", "table",
+        "check", 0
+    };
+    register int i;
+    register char *p;
+
+    p = symbol_prefix;
+    outline += 5;
+    fprintf(output_file, "    static constexpr int yyfinal = YYFINAL;\n\
+    static constexpr int yymaxtoken = YYMAXTOKEN;\n\
+    static constexpr int yytablesize = YYTABLESIZE;\n};\n\
+typedef %sbasic_tables<> %stables;\n", p, p);
+    for (i = 0; names[i]; ++i)
+    {
+        ++outline;
+        fprintf(output_file, "template <int N> constexpr short \
+%sbasic_tables<N>::%s%s[];\n", p, p, names[i]);
+    }
+    outline += 4;
+    fprintf(output_file, "#if YYDEBUG\n\
+template <int N> constexpr const char *%sbasic_tables<N>::%sname[];\n\
+template <int N> constexpr const char *%sbasic_tables<N>::%srule[];\n\
+#endif\n", p, p, p, p);
 }
 
 
@@ -1076,6 +2014,130 @@ output_stype()
 }
 
 
+/**
+*   @brief Writes a table of value stack sizes
+*
+*   Each entry is the total size of the slots of a sequence of symbols, written as a sum of the macros YYVSk (see
+*   value_slot()), or as 0. The entries are wrapped like those of yyname.
+*
+*   @param[in] name The name of the table, without the prefix
+*   @param[in] n The number of entries
+*   @param[in] items The array that holds the sequences of symbols
+*   @param[in] first The index in items of the first symbol of each entry
+*   @param[in] count The number of symbols of each entry
+*/
+output_slot_table(name, n, items, first, count)
+char *name;
+int n;
+short *items;
+short *first;
+short *count;
+{
+    register int i, j, k, len;
+    register char *s;
+    register FILE *out;
+    char *buf;
+
+    out = code_file;
+    k = 0;
+    for (i = 0; i < n; ++i)
+        if (count[i] > k) k = count[i];
+    buf = MALLOC(8*k + 16);
+    if (buf == 0) no_space();
+
+    fprintf(out, "%sshort %s%s[] = {", storage, symbol_prefix, name);
+    len = 80;
+    for (i = 0; i < n; ++i)
+    {
+        s = buf;
+        for (j = 0; j < count[i]; ++j)
+        {
+            k = symbol_slot[items[first[i] + j]];
+            if (k >= 0)
+            {
+                if (s > buf) *s++ = '+';
+                sprintf(s, "YYVS%d", k);
+                s += strlen(s);
+            }
+        }
+        if (s == buf) *s++ = '0';
+        *s++ = ',';
+        *s = '\0';
+
+        k = s - buf;
+        len += k;
+        if (len > 80)
+        {
+            ++outline;
+            putc('\n', out);
+            len = k;
+        }
+        fputs(buf, out);
+    }
+    outline += 2;
+    fprintf(out, "\n};\n");
+    FREE(buf);
+}
+
+
+/**
+*   @brief Writes the definitions used by the typed value stack
+*
+*   With the --typed-stack option, yyvsp is a char pointer just past the top of a stack of slots of different sizes
+*   (see value_slot()). The tables yyvsize, yyvlen and yyvfirst give the size of the slot of the accessing symbol of
+*   each state, the total size of the right-hand side of each rule, and the size of the slot of $1 for the rules that
+*   need the default value of $$, so that yyparse can shift, reduce and discard states. The sizes are written as C
+*   constant expressions, because only the C compiler knows the sizes of the members of YYSTYPE.
+*/
+output_typed_stack()
+{
+    register int i, k;
+    register FILE *out;
+    short *first, *count;
+
+    out = code_file;
+    outline += 6;
+    fprintf(out, "#define YYTYPEDSTACK 1\n\
+#include <string.h>\n\
+struct yyvalign { char c; YYSTYPE v; };\n\
+#define YYVALIGN (sizeof(struct yyvalign) - sizeof(YYSTYPE))\n\
+#define YYVSLOT(t) ((sizeof(((YYSTYPE *)0)->t) + YYVALIGN - 1) / YYVALIGN * YYVALIGN)\n\
+#define YYVS0 sizeof(YYSTYPE)\n");
+    for (i = 0; i < ntags; ++i)
+    {
+        ++outline;
+        fprintf(out, "#define YYVS%d YYVSLOT(%s)\n", i + 1, tag_table[i]);
+    }
+    free_tags();
+
+    k = nstates > nrules ? nstates : nrules;
+    first = NEW2(k, short);
+    count = NEW2(k, short);
+
+    for (i = 0; i < nstates; ++i)
+    {
+        first[i] = i;
+        count[i] = (i > 0);
+    }
+    output_slot_table("vsize", nstates, accessing_symbol, first, count);
+    FREE(accessing_symbol);
+
+    for (i = 2; i < nrules; ++i)
+    {
+        first[i - 2] = rrhs[i];
+        count[i - 2] = rrhs[i + 1] - rrhs[i] - 1;
+    }
+    output_slot_table("vlen", nrules - 2, ritem, first, count);
+
+    for (i = 2; i < nrules; ++i)
+        count[i - 2] = (i > 2 && needs_default(i));
+    output_slot_table("vfirst", nrules - 2, ritem, first, count);
+
+    FREE(first);
+    FREE(count);
+}
+
+
 output_trailing_text()
 {
     register int c, last;
@@ -1133,40 +2195,233 @@ output_trailing_text()
 }
 
 
-output_semantic_actions()
+/**
+*   @brief Prepares action_file for reading
+*
+*   Closes the temporary file where copy_action() saved the code of the semantic actions and reopens it for reading.
+*
+*   @return 0 if the grammar contains no semantic actions, 1 otherwise
+*/
+int
+open_actions()
 {
-    register int c, last;
-    register FILE *out;
+    register int i;
 
     fclose(action_file);
     action_file = fopen(action_file_name, "r");
     if (action_file == NULL)
         open_error(action_file_name);
 
-    if ((c = getc(action_file)) == EOF)
-        return;
+    for (i = 3; i < nrules; ++i)
+        if (raction[i].offset >= 0)
+            return (1);
+    return (0);
+}
+
 
+/**
+*   @brief Copies the code of a semantic action to the code file
+*
+*   The code is preceded by a #line directive pointing to the position of the action in the input file, unless the
+*   -l option has been specified.
+*
+*   @param[in] rule The rule whose action must be written
+*/
+output_action_code(rule)
+int rule;
+{
+    register int c;
+    register long n;
+    register FILE *in, *out;
+
+    in = action_file;
     out = code_file;
-    last = c;
-    if (c == '\n')
+    if (!lflag)
+    {
         ++outline;
-    putc(c, out);
-    while ((c = getc(action_file)) != EOF)
+        fprintf(out, line_format, raction[rule].lineno, input_file_name);
+    }
+
+    fseek(in, raction[rule].offset, 0);
+    for (n = raction[rule].length; n > 0; --n)
     {
+        c = getc(in);
         if (c == '\n')
             ++outline;
         putc(c, out);
-        last = c;
     }
+}
 
-    if (last != '\n')
+
+/**
+*   @brief Tells whether the default value of $$ must be computed before an action
+*
+*   Before reducing by a rule, yyparse() sets $$ to the value of $1, so that rules without an action pass the value
+*   of their first symbol up. The copy is a waste of time for empty rules, whose $1 does not exist, and for rules
+*   whose action begins by assigning $$ (see lhs_reference() in reader.c), so it is only generated where needed.
+*
+*   @param[in] rule The number of the rule
+*   @return 1 if the value of $1 must be copied into yyval, 0 otherwise
+*/
+int
+needs_default(rule)
+int rule;
+{
+    if (rrhs[rule + 1] - rrhs[rule] == 1)
+        return (0);
+    if (raction[rule].offset >= 0 && raction[rule].assigns)
+        return (0);
+    return (1);
+}
+
+
+output_semantic_actions()
+{
+    register int i, j;
+    register FILE *out;
+
+    out = code_file;
+    if (open_actions())
+    {
+        for (i = 3; i < nrules; ++i)
+        {
+            if (raction[i].offset < 0 || raction[i].same != i)
+                continue;
+
+            for (j = i; j; j = raction[j].next)
+            {
+                ++outline;
+                fprintf(out, "case %d:\n", j - 2);
+            }
+            if (cxxflag && needs_default(i))
+            {
+                ++outline;
+                fprintf(out, "yyval = YYSTYPE();\n");
+            }
+            else if (!tsflag && needs_default(i))
+            {
+                ++outline;
+                fprintf(out, "yyval = yyvsp[1-yym];\n");
+            }
+            output_action_code(i);
+            outline += 2;
+            fprintf(out, "\nbreak;\n");
+        }
+
+        if (!lflag)
+            fprintf(out, line_format, ++outline + 1, code_file_name);
+    }
+
+    j = 0;
+    for (i = 3; i < nrules; ++i)
+    {
+        if (raction[i].offset < 0 && !tsflag && !needs_default(i))
+        {
+            ++outline;
+            fprintf(out, "    case %d:\n", i - 2);
+            j = 1;
+        }
+    }
+    if (j)
     {
         ++outline;
-        putc('\n', out);
+        fprintf(out, "        break;\n");
     }
+}
 
-    if (!lflag)
-        fprintf(out, line_format, ++outline + 1, code_file_name);
+
+/**
+*   @brief Writes each semantic action as a separate function
+*
+*   This is the alternative to output_semantic_actions() selected by the --action-functions option. Instead of a
+*   single switch inside yyparse(), which grows with the number of rules and is hard for compilers to optimize, every
+*   action becomes a small static function that receives the value stack pointer. The functions are collected in the
+*   table yyactions, indexed by rule number; rules without an action share the function yynoaction, and rules whose
+*   actions have been merged by merge_actions() share the function of the first rule of their group.
+*
+*   Rules without an action whose default value of $$ is needed share the function yydefaultN, where N is the length
+*   of their right-hand side. With the --typed-stack option the default value is copied by yyparse() instead, and the
+*   functions receive a char pointer (see output_typed_stack()).
+*
+*   The value returned by a function is zero, unless the action used YYABORT, YYACCEPT or YYERROR (see returns and
+*   call_action in skeleton.c).
+*/
+output_action_functions()
+{
+    register int i, j, k;
+    register FILE *out;
+    char *defaults;
+    char *stack;
+    char name[24];
+
+    out = code_file;
+    stack = tsflag ? "char" : "YYSTYPE";
+    write_section(returns);
+    outline += 5;
+    fprintf(out, "static int\nyynoaction(%s *yyvsp)\n{\n    return (0);\n}\n",
+            stack);
+
+    defaults = NEW2(nitems, char);
+    for (i = 3; i < nrules; ++i)
+    {
+        k = rrhs[i + 1] - rrhs[i] - 1;
+        if (raction[i].offset < 0 && !tsflag && needs_default(i) && !defaults[k])
+        {
+            defaults[k] = 1;
+            outline += 6;
+            fprintf(out, "static int\nyydefault%d(YYSTYPE *yyvsp)\n{\n\
+    yyval = yyvsp[%d];\n    return (0);\n}\n", k, 1 - k);
+        }
+    }
+    FREE(defaults);
+
+    if (open_actions())
+    {
+        for (i = 3; i < nrules; ++i)
+        {
+            if (raction[i].offset < 0 || raction[i].same != i)
+                continue;
+
+            outline += 3;
+            fprintf(out, "static int\nyyaction%d(%s *yyvsp)\n{\n", i - 2, stack);
+            if (!tsflag && needs_default(i))
+            {
+                ++outline;
+                fprintf(out, "    yyval = yyvsp[%d];\n", rrhs[i] - rrhs[i + 1] + 2);
+            }
+            output_action_code(i);
+            outline += 3;
+            fprintf(out, "\n    return (0);\n}\n");
+        }
+
+        if (!lflag)
+            fprintf(out, line_format, ++outline + 1, code_file_name);
+    }
+
+    ++outline;
+    fprintf(out, "static int (*const yyactions[])(%s *) = {", stack);
+    j = 80;
+    for (i = 2; i < nrules; ++i)
+    {
+        if (raction[i].offset >= 0)
+            sprintf(name, "yyaction%d,", raction[i].same - 2);
+        else if (i > 2 && !tsflag && needs_default(i))
+            sprintf(name, "yydefault%d,", rrhs[i + 1] - rrhs[i] - 1);
+        else
+            sprintf(name, "yynoaction,");
+
+        k = strlen(name);
+        j += k;
+        if (j > 80)
+        {
+            ++outline;
+            putc('\n', out);
+            j = k;
+        }
+        fputs(name, out);
+    }
+    outline += 2;
+    fprintf(out, "\n};\n");
 }
 
 
@@ -0,0 +1,242 @@
+#include "defs.h"
+
+/*  The profile read by the --profile option is written by yyprofdump   */
+/*  (see header in skeleton.c) from a parser compiled with YYPROFILE.   */
+/*  It is a text file: the line "states n", then one line "s state      */
+/*  count" for each state visited and one line "t state token count"   */
+/*  for each token looked up in a state.  States are numbered as they   */
+/*  are without a profile, so that profiles can be merged and reused    */
+/*  after the parser has been regenerated.                              */
+
+/**
+*   @brief Weights of the rows of the action tables, set by profile()
+*
+*   The first nstates entries give the number of hits of the shift row of each state, the next nstates entries those
+*   of its reduce row. sort_actions() packs the heaviest rows first.
+*/
+long *row_weight;
+
+/**
+*   @brief The number that each state had before it was renumbered by profile()
+*/
+short *canonical_state;
+
+static long *state_hits;
+static int nhits;
+static int maxhits;
+static short *hit_state;
+static short *hit_token;
+static long *hit_count;
+
+extern short *permute();
+
+
+/**
+*   @brief Applies the profile named by the --profile option
+*
+*   The states, except the initial state, are renumbered by decreasing number of visits, and the rows of the action
+*   tables are weighted by the number of lookups of their tokens, so that the hot part of the tables is packed
+*   together at their beginning.
+*/
+profile()
+{
+    read_profile();
+    renumber_states();
+    weigh_rows();
+    FREE(state_hits);
+    FREE(hit_state);
+    FREE(hit_token);
+    FREE(hit_count);
+}
+
+
+read_profile()
+{
+    register FILE *f;
+    char c;
+    int state, token;
+    long count;
+
+    f = fopen(profile_file_name, "r");
+    if (f == 0) open_error(profile_file_name);
+
+    if (fscanf(f, "states %d", &state) != 1)
+        profile_error("missing state count");
+    if (state != nstates)
+        profile_error("the number of states does not match the grammar");
+
+    state_hits = NEW2(nstates, long);
+    maxhits = 100;
+    nhits = 0;
+    hit_state = NEW2(maxhits, short);
+    hit_token = NEW2(maxhits, short);
+    hit_count = NEW2(maxhits, long);
+
+    while (fscanf(f, " %c", &c) == 1)
+    {
+        if (c == 's')
+        {
+            if (fscanf(f, "%d %ld", &state, &count) != 2)
+                profile_error("invalid state line");
+            if (state < 0 || state >= nstates)
+                profile_error("state out of range");
+            state_hits[state] += count;
+        }
+        else if (c == 't')
+        {
+            if (fscanf(f, "%d %d %ld", &state, &token, &count) != 3)
+                profile_error("invalid token line");
+            if (state < 0 || state >= nstates)
+                profile_error("state out of range");
+            if (nhits >= maxhits)
+            {
+                maxhits += 100 + maxhits;
+                hit_state = (short *) REALLOC(hit_state, maxhits*sizeof(short));
+                if (hit_state == 0) no_space();
+                hit_token = (short *) REALLOC(hit_token, maxhits*sizeof(short));
+                if (hit_token == 0) no_space();
+                hit_count = (long *) REALLOC(hit_count, maxhits*sizeof(long));
+                if (hit_count == 0) no_space();
+            }
+            hit_state[nhits] = state;
+            hit_token[nhits] = token;
+            hit_count[nhits] = count;
+            ++nhits;
+        }
+        else
+            profile_error("unknown line");
+    }
+    fclose(f);
+}
+
+
+/**
+*   @brief Renumbers the states by decreasing number of visits
+*
+*   State 0 stays the initial state, and states with the same number of visits keep their relative order. Every
+*   structure that refers to states after make_parser() is renumbered, so that verbose() and output() see only the new
+*   numbers.
+*/
+renumber_states()
+{
+    register int i, j, k;
+    register short *map;
+    register shifts *sp;
+    register action *p;
+    core **cv;
+    shifts **sv;
+    reductions **rv;
+    action **av;
+
+    canonical_state = NEW2(nstates, short);
+    canonical_state[0] = 0;
+    for (i = 1; i < nstates; ++i)
+    {
+        j = i - 1;
+        while (j > 0 && state_hits[canonical_state[j]] < state_hits[i])
+            --j;
+        for (k = i - 1; k > j; --k)
+            canonical_state[k + 1] = canonical_state[k];
+        canonical_state[j + 1] = i;
+    }
+
+    map = NEW2(nstates, short);
+    for (i = 0; i < nstates; ++i)
+        map[canonical_state[i]] = i;
+
+    cv = NEW2(nstates, core *);
+    sv = NEW2(nstates, shifts *);
+    rv = NEW2(nstates, reductions *);
+    av = NEW2(nstates, action *);
+    for (i = 0; i < nstates; ++i)
+    {
+        k = canonical_state[i];
+        cv[i] = state_table[k];
+        cv[i]->number = i;
+        if (sp = shift_table[k])
+            sp->number = i;
+        sv[i] = sp;
+        if (rv[i] = reduction_table[k])
+            rv[i]->number = i;
+        for (p = parser[k]; p; p = p->next)
+            if (p->action_code == SHIFT)
+                p->number = map[p->number];
+        av[i] = parser[k];
+    }
+    FREE(state_table);
+    FREE(shift_table);
+    FREE(reduction_table);
+    FREE(parser);
+    state_table = cv;
+    shift_table = sv;
+    reduction_table = rv;
+    parser = av;
+
+    accessing_symbol = permute(accessing_symbol);
+    defred = permute(defred);
+    SRconflicts = permute(SRconflicts);
+    RRconflicts = permute(RRconflicts);
+
+    for (i = goto_map[ntokens]; i < goto_map[nsyms]; ++i)
+    {
+        from_state[i] = map[from_state[i]];
+        to_state[i] = map[to_state[i]];
+    }
+    final_state = map[final_state];
+
+    FREE(map);
+}
+
+
+/**
+*   @brief Returns a copy of a table indexed by state, in the order of the new state numbers, and frees the table
+*/
+short *
+permute(table)
+short *table;
+{
+    register int i;
+    register short *v;
+
+    v = NEW2(nstates, short);
+    for (i = 0; i < nstates; ++i)
+        v[i] = table[canonical_state[i]];
+    FREE(table);
+    return (v);
+}
+
+
+/**
+*   @brief Adds the lookups of each (state, token) pair of the profile to the row that holds its action
+*
+*   A token without an action in the rows, either because it is an error or because it is covered by the default
+*   reduction of the state, adds nothing.
+*/
+weigh_rows()
+{
+    register int i, s;
+    register action *p;
+    short *map;
+
+    map = NEW2(nstates, short);
+    for (i = 0; i < nstates; ++i)
+        map[canonical_state[i]] = i;
+
+    row_weight = NEW2(2*nstates, long);
+    for (i = 0; i < nhits; ++i)
+    {
+        s = map[hit_state[i]];
+        for (p = parser[s]; p; p = p->next)
+        {
+            if (p->suppressed == 0 && symbol_value[p->symbol] == hit_token[i])
+            {
+                if (p->action_code == SHIFT)
+                    row_weight[s] += hit_count[i];
+                else if (p->number != defred[s])
+                    row_weight[nstates + s] += hit_count[i];
+                break;
+            }
+        }
+    }
+    FREE(map);
+}
@@ -948,6 +948,7 @@ read_declarations()
         switch (k = keyword())
         {
         case MARK:
+            if (ntags == 0) tsflag = 0;
             return;
 
         case IDENT:
@@ -1009,6 +1010,11 @@ initialize_grammar()
     rassoc[0] = TOKEN;
     rassoc[1] = TOKEN;
     rassoc[2] = TOKEN;
+    raction = (action_text *) MALLOC(maxrules*sizeof(action_text));
+    if (raction == 0) no_space();
+    raction[0].offset = -1;
+    raction[1].offset = -1;
+    raction[2].offset = -1;
 }
 
 
@@ -1029,6 +1035,8 @@ expand_rules()
     if (rprec == 0) no_space();
     rassoc = (char *) REALLOC(rassoc, maxrules*sizeof(char));
     if (rassoc == 0) no_space();
+    raction = (action_text *) REALLOC(raction, maxrules*sizeof(action_text));
+    if (raction == 0) no_space();
 }
 
 
@@ -1094,6 +1102,7 @@ int s_lineno;
     plhs[nrules] = bp;
     rprec[nrules] = UNDEFINED;
     rassoc[nrules] = TOKEN;
+    raction[nrules].offset = -1;
 }
 
 
@@ -1142,6 +1151,7 @@ insert_empty_rule()
     rprec[nrules-1] = 0;
     rassoc[nrules] = rassoc[nrules-1];
     rassoc[nrules-1] = TOKEN;
+    raction[nrules].offset = -1;
 }
 
 
@@ -1176,11 +1186,105 @@ add_symbol()
 }
 
 
+/**
+*   @brief Classifies a reference to $$ inside a semantic action
+*
+*   copy_action() keeps track of whether the action begins with an assignment to $$ that does not itself read $$.
+*   Only in that case the value of $$ set by default (the value of $1) is never observed, and the generated parser
+*   can skip copying it (see output_semantic_actions()).
+*
+*   @param[in] assign The current state: 0 if nothing but braces, white space and comments has been seen yet, 1 if
+*       inside the first statement, which assigns $$, 2 if the classification is complete
+*   @return The new state, given that $$ occurs at cptr
+*/
+int
+lhs_reference(assign)
+int assign;
+{
+    register char *s;
+
+    if (assign == 0)
+    {
+        for (s = cptr; *s == ' ' || *s == '\t'; ++s)
+            continue;
+        if (s[0] == '=' && s[1] != '=')
+            return (1);
+    }
+    return (2);
+}
+
+
+/**
+*   @brief Returns the slot taken by the value of a symbol in the typed value stack
+*
+*   With the --typed-stack option each value is stored in a slot just as large as the %union member given by the tag
+*   of its symbol, rounded up to the alignment of YYSTYPE. Tokens without a tag have no value; other symbols without a
+*   tag, and the symbols of mid-rule actions, whose value is usually set with $<tag>$, take a whole YYSTYPE.
+*
+*   @param[in] bp The symbol
+*   @return -1 if the symbol has no slot, 0 if it takes a whole YYSTYPE, k if its slot holds the k-th tag
+*/
+int
+value_slot(bp)
+bucket *bp;
+{
+    register int i;
+
+    if (bp->tag == 0 || (bp->name[0] == '$' && bp->class == NONTERM))
+        return (bp->class == TERM ? -1 : 0);
+    for (i = 0; tag_table[i] != bp->tag; ++i)
+        continue;
+    return (i + 1);
+}
+
+
+/**
+*   @brief Writes a reference to $i in the typed value stack
+*
+*   yyvsp points just past the top of the stack, so the value of $i is found by subtracting the sizes of the slots of
+*   $i to $n, which are known once the right-hand side is. The sizes are written with the macros YYVSk, defined in the
+*   generated parser by output_typed_stack(), and folded by the C compiler.
+*
+*   @param[in] i The position of the symbol on the right-hand side
+*   @param[in] n The number of symbols on the right-hand side before the action
+*   @param[in] tag The tag of the reference
+*   @param[in] d_lineno The line of the reference, for error messages
+*/
+typed_reference(i, n, tag, d_lineno)
+int i, n;
+char *tag;
+int d_lineno;
+{
+    register int j, k;
+    register char *sep;
+
+    if (i <= 0 || i > n)
+        typed_stack_error(d_lineno, i);
+    k = value_slot(pitem[nitems + i - n - 1]);
+    if (k < 0 || (k > 0 && tag_table[k - 1] != tag))
+        typed_stack_error(d_lineno, i);
+
+    fprintf(action_file, "((YYSTYPE *)(yyvsp - (");
+    sep = "";
+    for (j = i; j <= n; ++j)
+    {
+        k = value_slot(pitem[nitems + j - n - 1]);
+        if (k >= 0)
+        {
+            fprintf(action_file, "%sYYVS%d", sep, k);
+            sep = "+";
+        }
+    }
+    fprintf(action_file, ")))->%s", tag);
+}
+
+
 copy_action()
 {
     register int c;
     register int i, n;
     int depth;
+    int assign;
     int quote;
     char *tag;
     register FILE *f = action_file;
@@ -1192,15 +1296,18 @@ copy_action()
         insert_empty_rule();
     last_was_action = 1;
 
-    fprintf(f, "case %d:\n", nrules - 2);
-    if (!lflag)
-        fprintf(f, line_format, lineno, input_file_name);
+    raction[nrules].offset = ftell(f);
+    raction[nrules].lineno = lineno;
+    raction[nrules].same = nrules;
+    raction[nrules].next = 0;
+    raction[nrules].assigns = 0;
     if (*cptr == '=') ++cptr;
 
     n = 0;
     for (i = nitems - 1; pitem[i]; --i) ++n;
 
     depth = 0;
+    assign = 0;
 loop:
     c = *cptr;
     if (c == '$')
@@ -1218,14 +1325,21 @@ loop:
             {
                 fprintf(f, "yyval.%s", tag);
                 ++cptr;
+                assign = lhs_reference(assign);
                 FREE(d_line);
                 goto loop;
             }
-            else if (isdigit(c))
+            if (assign == 0) assign = 2;
+            if (isdigit(c))
             {
                 i = get_number();
-                if (i > n) dollar_warning(d_lineno, i);
-                fprintf(f, "yyvsp[%d].%s", i - n, tag);
+                if (tsflag)
+                    typed_reference(i, n, tag, d_lineno);
+                else
+                {
+                    if (i > n) dollar_warning(d_lineno, i);
+                    fprintf(f, "yyvsp[%d].%s", i - n, tag);
+                }
                 FREE(d_line);
                 goto loop;
             }
@@ -1233,6 +1347,7 @@ loop:
             {
                 ++cptr;
                 i = -get_number() - n;
+                if (tsflag) typed_stack_error(d_lineno, i + n);
                 fprintf(f, "yyvsp[%d].%s", i, tag);
                 FREE(d_line);
                 goto loop;
@@ -1251,10 +1366,12 @@ loop:
             else
                 fprintf(f, "yyval");
             cptr += 2;
+            assign = lhs_reference(assign);
             goto loop;
         }
         else if (isdigit(cptr[1]))
         {
+            if (assign == 0) assign = 2;
             ++cptr;
             i = get_number();
             if (ntags)
@@ -1263,7 +1380,10 @@ loop:
                     unknown_rhs(i);
                 tag = pitem[nitems + i - n - 1]->tag;
                 if (tag == 0) untyped_rhs(i, pitem[nitems + i - n - 1]->name);
-                fprintf(f, "yyvsp[%d].%s", i - n, tag);
+                if (tsflag)
+                    typed_reference(i, n, tag, lineno);
+                else
+                    fprintf(f, "yyvsp[%d].%s", i - n, tag);
             }
             else
             {
@@ -1275,14 +1395,19 @@ loop:
         }
         else if (cptr[1] == '-')
         {
+            if (assign == 0) assign = 2;
             cptr += 2;
             i = get_number();
+            if (tsflag)
+                typed_stack_error(lineno, -i);
             if (ntags)
                 unknown_rhs(-i);
             fprintf(f, "yyvsp[%d]", -i - n);
             goto loop;
         }
     }
+    if (assign == 0 && !isspace(c) && c != '{' && c != '/')
+        assign = 2;
     if (isalpha(c) || c == '_' || c == '$')
     {
         do
@@ -1303,8 +1428,13 @@ loop:
         unterminated_action(a_lineno, a_line, a_cptr);
 
     case ';':
+        if (assign == 1)
+        {
+            raction[nrules].assigns = 1;
+            assign = 2;
+        }
         if (depth > 0) goto loop;
-        fprintf(f, "\nbreak;\n");
+        raction[nrules].length = ftell(f) - raction[nrules].offset;
         return;
 
     case '{':
@@ -1313,7 +1443,7 @@ loop:
 
     case '}':
         if (--depth > 0) goto loop;
-        fprintf(f, "\nbreak;\n");
+        raction[nrules].length = ftell(f) - raction[nrules].offset;
         return;
 
     case '\'':
@@ -1391,6 +1521,7 @@ loop:
                 }
             }
         }
+        if (assign == 0) assign = 2;
         goto loop;
 
     default:
@@ -1574,6 +1705,11 @@ pack_symbols()
     if (symbol_prec == 0) no_space();
     symbol_assoc = MALLOC(nsyms);
     if (symbol_assoc == 0) no_space();
+    if (tsflag)
+    {
+        symbol_slot = (short *) MALLOC(nsyms*sizeof(short));
+        if (symbol_slot == 0) no_space();
+    }
 
     v = (bucket **) MALLOC(nsyms*sizeof(bucket *));
     if (v == 0) no_space();
@@ -1650,17 +1786,20 @@ pack_symbols()
     symbol_value[0] = 0;
     symbol_prec[0] = 0;
     symbol_assoc[0] = TOKEN;
+    if (tsflag) symbol_slot[0] = -1;
     for (i = 1; i < ntokens; ++i)
     {
         symbol_name[i] = v[i]->name;
         symbol_value[i] = v[i]->value;
         symbol_prec[i] = v[i]->prec;
         symbol_assoc[i] = v[i]->assoc;
+        if (tsflag) symbol_slot[i] = value_slot(v[i]);
     }
     symbol_name[start_symbol] = name_pool;
     symbol_value[start_symbol] = -1;
     symbol_prec[start_symbol] = 0;
     symbol_assoc[start_symbol] = TOKEN;
+    if (tsflag) symbol_slot[start_symbol] = 0;
     for (++i; i < nsyms; ++i)
     {
         k = v[i]->index;
@@ -1668,6 +1807,7 @@ pack_symbols()
         symbol_value[k] = v[i]->value;
         symbol_prec[k] = v[i]->prec;
         symbol_assoc[k] = v[i]->assoc;
+        if (tsflag) symbol_slot[k] = value_slot(v[i]);
     }
 
     FREE(v);
@@ -1692,6 +1832,8 @@ pack_grammar()
     if (rprec == 0) no_space();
     rassoc = REALLOC(rassoc, nrules);
     if (rassoc == 0) no_space();
+    raction = (action_text *) REALLOC(raction, nrules*sizeof(action_text));
+    if (raction == 0) no_space();
 
     ritem[0] = -1;
     ritem[1] = goal->index;
@@ -1736,6 +1878,168 @@ pack_grammar()
 }
 
 
+/**
+*   @brief Reads the code of a semantic action in normalized form
+*
+*   The code saved by copy_action() is read back from action_file and reduced to a canonical text, in which comments
+*   and runs of white space are replaced by a single space. Newlines are kept only around preprocessor directives,
+*   where they are significant. String and character literals are copied unchanged.
+*
+*   @param[in] rule The rule whose action must be read
+*   @return A newly allocated, null-terminated string
+*/
+char *
+normalize_action(rule)
+int rule;
+{
+    register int c, quote;
+    register char *s, *t;
+    register FILE *f = action_file;
+    long n;
+    int space, directive;
+    char *buf;
+
+    buf = MALLOC(raction[rule].length + 1);
+    if (buf == 0) no_space();
+
+    fseek(f, raction[rule].offset, 0);
+    for (n = 0; n < raction[rule].length; ++n)
+        buf[n] = getc(f);
+    buf[n] = NUL;
+
+    space = 0;
+    directive = 0;
+    quote = 0;
+    t = buf;
+    for (s = buf; c = *s; ++s)
+    {
+        if (quote)
+        {
+            *t++ = c;
+            if (c == '\\' && s[1])
+                *t++ = *++s;
+            else if (c == quote)
+                quote = 0;
+        }
+        else if (c == '/' && s[1] == '*')
+        {
+            for (s += 2; *s && !(*s == '*' && s[1] == '/'); ++s)
+                if (*s == '\n') space = 2;
+            if (*s == NUL) break;
+            ++s;
+            if (space == 0) space = 1;
+        }
+        else if (isspace(c))
+        {
+            if (c == '\n')
+                space = 2;
+            else if (space == 0)
+                space = 1;
+        }
+        else
+        {
+            if (space == 2 && (directive || c == '#'))
+            {
+                *t++ = '\n';
+                directive = (c == '#');
+            }
+            else if (space && t > buf)
+                *t++ = ' ';
+            else if (t == buf && c == '#')
+                directive = 1;
+            space = 0;
+            if (c == '\'' || c == '"')
+                quote = c;
+            *t++ = c;
+        }
+    }
+    *t = NUL;
+
+    return (buf);
+}
+
+
+/**
+*   @brief Groups the rules whose semantic actions are identical
+*
+*   Machine-generated grammars often repeat the same action for many rules. When the --merge-actions option is given,
+*   the normalized code of each action (see normalize_action()) is hashed and compared with the actions seen before.
+*   Since $-names have already been substituted, two actions are equal only if they access the value stack in the
+*   same way. The code written for a group copies the default value of $$ only if its first rule needs it (see
+*   needs_default() in output.c), so the rules of a group must all need it or all not. When actions are written as
+*   functions, the default value of $$ is copied from a fixed position of the stack (see output_action_functions()),
+*   so the rules must also have the same length, unless the action assigns $$ first. Each action that matches a
+*   previous one is linked to the group of that action through fields same and next of raction, so that output.c can
+*   write the shared code only once.
+*/
+merge_actions()
+{
+    register int i, j;
+    register unsigned h;
+    register char *s;
+    char **text;
+    unsigned *hash;
+    short *bucket_head, *chain, *last;
+    int nbuckets;
+
+    fclose(action_file);
+    action_file = fopen(action_file_name, "r");
+    if (action_file == NULL)
+        open_error(action_file_name);
+
+    nbuckets = 1;
+    while (nbuckets < nrules) nbuckets <<= 1;
+    text = NEW2(nrules, char *);
+    hash = NEW2(nrules, unsigned);
+    chain = NEW2(nrules, short);
+    last = NEW2(nrules, short);
+    bucket_head = NEW2(nbuckets, short);
+
+    for (i = 3; i < nrules; ++i)
+    {
+        if (raction[i].offset < 0) continue;
+
+        s = normalize_action(i);
+        h = 0;
+        for (j = 0; s[j]; ++j)
+            h = 31*h + (unsigned char) s[j];
+
+        for (j = bucket_head[h & (nbuckets - 1)]; j; j = chain[j])
+        {
+            if (hash[j] == h && strcmp(text[j], s) == 0 &&
+                    needs_default(i) == needs_default(j) &&
+                    (!fnflag || raction[i].assigns ||
+                     rrhs[i + 1] - rrhs[i] == rrhs[j + 1] - rrhs[j]))
+                break;
+        }
+
+        if (j)
+        {
+            FREE(s);
+            raction[last[j]].next = i;
+            raction[i].same = j;
+            last[j] = i;
+        }
+        else
+        {
+            text[i] = s;
+            last[i] = i;
+            hash[i] = h;
+            chain[i] = bucket_head[h & (nbuckets - 1)];
+            bucket_head[h & (nbuckets - 1)] = i;
+        }
+    }
+
+    for (i = 0; i < nrules; ++i)
+        if (text[i]) FREE(text[i]);
+    FREE(text);
+    FREE(hash);
+    FREE(chain);
+    FREE(last);
+    FREE(bucket_head);
+}
+
+
 print_grammar()
 {
     register int i, j, k;
@@ -1774,16 +2078,22 @@ print_grammar()
 
 reader()
 {
+    if (cxxflag)
+        begin_include_guard();
+    else
+        write_section(sccsid);
     write_section(banner);
     create_symbol_table();
     read_declarations();
     read_grammar();
     free_symbol_table();
-    free_tags();
+    if (!tsflag) free_tags();
     pack_names();
     check_symbols();
     pack_symbols();
     pack_grammar();
     free_symbols();
+    reduce_grammar();
+    if (mgflag) merge_actions();
     print_grammar();
 }
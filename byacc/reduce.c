@@ -0,0 +1,290 @@
+#include "defs.h"
+
+/*  The grammar is reduced before the LR(0) automaton is built.  A      */
+/*  nonterminal is useless if it derives no string of tokens or if the  */
+/*  start symbol derives no sentential form that contains it, and a     */
+/*  rule is useless if it contains a useless nonterminal.  The useless  */
+/*  rules and nonterminals are removed, so that the dead parts of a     */
+/*  generated grammar cost no states.  The tokens are kept: their       */
+/*  numbers are part of the interface of the parser.                   */
+
+static char *productive;
+static char *reachable;
+static short *pending;
+static short *occ_start;
+static short *occ_rule;
+static short *lhs_start;
+static short *lhs_rule;
+
+
+/**
+*   @brief Removes the useless rules and nonterminals from the grammar and reports them
+*
+*   Both passes take time linear in the size of the grammar. If the start symbol derives no sentence at all, the
+*   grammar is left as it is, with a warning.
+*/
+reduce_grammar()
+{
+    register int i, nuseless;
+
+    index_rules();
+    find_productive();
+    if (!productive[start_symbol + 1])
+        unproductive_goal_warning(symbol_name[start_symbol + 1]);
+    else
+    {
+        find_reachable_symbols();
+        nuseless = 0;
+        for (i = start_symbol + 1; i < nsyms; ++i)
+            if (!productive[i] || !reachable[i]) ++nuseless;
+
+        if (nuseless)
+            remove_useless(nuseless);
+    }
+
+    FREE(productive);
+    FREE(reachable);
+    FREE(pending);
+    FREE(occ_start + start_symbol);
+    FREE(occ_rule);
+    FREE(lhs_start + start_symbol);
+    FREE(lhs_rule);
+}
+
+
+/**
+*   @brief Lists the rules in which each nonterminal occurs on the right-hand side, and the rules of each nonterminal
+*
+*   A nonterminal that occurs several times in a rule is listed once for each occurrence, and pending[] gets the
+*   number of such occurrences in each rule. The lists are indexed by the nonterminal, from occ_start[] and
+*   lhs_start[] up to the start of the next one.
+*/
+index_rules()
+{
+    register int i, rule;
+    register short *sp;
+    register short *occ_next;
+    register short *lhs_next;
+
+    occ_start = NEW2(nvars + 1, short) - start_symbol;
+    lhs_start = NEW2(nvars + 1, short) - start_symbol;
+    pending = NEW2(nrules, short);
+
+    for (rule = 2; rule < nrules; ++rule)
+    {
+        ++lhs_start[rlhs[rule] + 1];
+        for (sp = ritem + rrhs[rule]; *sp >= 0; ++sp)
+        {
+            if (ISVAR(*sp))
+            {
+                ++occ_start[*sp + 1];
+                ++pending[rule];
+            }
+        }
+    }
+    for (i = start_symbol + 1; i <= nsyms; ++i)
+    {
+        occ_start[i] += occ_start[i - 1];
+        lhs_start[i] += lhs_start[i - 1];
+    }
+
+    occ_rule = NEW2(occ_start[nsyms] + 1, short);
+    lhs_rule = NEW2(lhs_start[nsyms] + 1, short);
+    occ_next = NEW2(nvars, short) - start_symbol;
+    lhs_next = NEW2(nvars, short) - start_symbol;
+    for (i = start_symbol; i < nsyms; ++i)
+    {
+        occ_next[i] = occ_start[i];
+        lhs_next[i] = lhs_start[i];
+    }
+    for (rule = 2; rule < nrules; ++rule)
+    {
+        lhs_rule[lhs_next[rlhs[rule]]++] = rule;
+        for (sp = ritem + rrhs[rule]; *sp >= 0; ++sp)
+            if (ISVAR(*sp))
+                occ_rule[occ_next[*sp]++] = rule;
+    }
+
+    FREE(occ_next + start_symbol);
+    FREE(lhs_next + start_symbol);
+}
+
+
+/**
+*   @brief Finds the nonterminals that derive a string of tokens
+*
+*   A rule whose right-hand side has no nonterminal left that is not known to be productive makes its left-hand side
+*   productive. Each occurrence of a nonterminal is counted down once, when the nonterminal becomes productive.
+*/
+find_productive()
+{
+    register int i, j, rule, symbol;
+    register short *queue;
+    int head, tail;
+
+    productive = NEW2(nsyms, char);
+    queue = NEW2(nrules, short);
+
+    tail = 0;
+    for (rule = 2; rule < nrules; ++rule)
+        if (pending[rule] == 0)
+            queue[tail++] = rule;
+
+    for (head = 0; head < tail; ++head)
+    {
+        symbol = rlhs[queue[head]];
+        if (productive[symbol])
+            continue;
+        productive[symbol] = 1;
+        for (i = occ_start[symbol]; i < occ_start[symbol + 1]; ++i)
+        {
+            j = occ_rule[i];
+            if (--pending[j] == 0)
+                queue[tail++] = j;
+        }
+    }
+
+    FREE(queue);
+}
+
+
+/**
+*   @brief Finds the nonterminals that occur in a sentential form derived from the start symbol by productive rules
+*/
+find_reachable_symbols()
+{
+    register int i, symbol, head, tail;
+    register short *sp;
+    register short *queue;
+
+    reachable = NEW2(nsyms, char);
+    queue = NEW2(nvars, short);
+
+    reachable[start_symbol] = 1;
+    queue[0] = start_symbol;
+    tail = 1;
+    for (head = 0; head < tail; ++head)
+    {
+        symbol = queue[head];
+        for (i = lhs_start[symbol]; i < lhs_start[symbol + 1]; ++i)
+        {
+            if (pending[lhs_rule[i]])
+                continue;
+            for (sp = ritem + rrhs[lhs_rule[i]]; *sp >= 0; ++sp)
+            {
+                if (ISVAR(*sp) && !reachable[*sp])
+                {
+                    reachable[*sp] = 1;
+                    queue[tail++] = *sp;
+                }
+            }
+        }
+    }
+
+    FREE(queue);
+}
+
+
+/**
+*   @brief Lists a useless rule in y.output
+*/
+log_useless_rule(rule)
+int rule;
+{
+    register short *sp;
+
+    fprintf(verbose_file, "\t%s :", symbol_name[rlhs[rule]]);
+    for (sp = ritem + rrhs[rule]; *sp >= 0; ++sp)
+        fprintf(verbose_file, " %s", symbol_name[*sp]);
+    fprintf(verbose_file, "\n");
+}
+
+
+/**
+*   @brief Removes the useless rules and nonterminals, renumbering the ones that are kept
+*
+*   The rules and the nonterminals keep their order. The values of the nonterminals, which index the goto tables,
+*   are numbered again from 0 for the start symbol. The useless ones are listed at the start of y.output.
+*
+*   @param[in] nuseless The number of useless nonterminals
+*/
+remove_useless(nuseless)
+int nuseless;
+{
+    register int i, j, k, rule;
+    register short *map;
+    register short *sp;
+    int nuseful;
+
+    map = NEW2(nsyms, short);
+    for (i = 0; i <= start_symbol; ++i)
+        map[i] = i;
+    k = start_symbol + 1;
+    for (i = start_symbol + 1; i < nsyms; ++i)
+        map[i] = productive[i] && reachable[i] ? k++ : -1;
+
+    nuseful = 3;
+    for (rule = 3; rule < nrules; ++rule)
+        if (pending[rule] == 0 && reachable[rlhs[rule]]) ++nuseful;
+
+    if (vflag)
+    {
+        fprintf(verbose_file, "Useless nonterminals:\n\n");
+        for (i = start_symbol + 1; i < nsyms; ++i)
+            if (map[i] < 0)
+                fprintf(verbose_file, "\t%s\n", symbol_name[i]);
+        fprintf(verbose_file, "\n\nUseless rules:\n\n");
+        for (rule = 3; rule < nrules; ++rule)
+            if (pending[rule] || !reachable[rlhs[rule]])
+                log_useless_rule(rule);
+        fprintf(verbose_file, "\n\n");
+    }
+
+    j = rrhs[3];
+    k = 3;
+    for (rule = 3; rule < nrules; ++rule)
+    {
+        if (pending[rule] || !reachable[rlhs[rule]])
+            continue;
+
+        sp = ritem + rrhs[rule];
+        rrhs[k] = j;
+        for (; *sp >= 0; ++sp)
+            ritem[j++] = map[*sp];
+        ritem[j++] = -k;
+        rlhs[k] = map[rlhs[rule]];
+        rprec[k] = rprec[rule];
+        rassoc[k] = rassoc[rule];
+        raction[k] = raction[rule];
+        raction[k].same = k;
+        ++k;
+    }
+    rrhs[k] = j;
+    nitems = j;
+
+    for (i = start_symbol + 1; i < nsyms; ++i)
+    {
+        if (map[i] < 0)
+            continue;
+        k = map[i];
+        symbol_name[k] = symbol_name[i];
+        symbol_prec[k] = symbol_prec[i];
+        symbol_assoc[k] = symbol_assoc[i];
+        symbol_value[k] = k - start_symbol - 1;
+        if (tsflag) symbol_slot[k] = symbol_slot[i];
+    }
+
+    if (nuseless == 1)
+        fprintf(stderr, "%s: 1 useless nonterminal", myname);
+    else
+        fprintf(stderr, "%s: %d useless nonterminals", myname, nuseless);
+    if (nrules - nuseful == 1)
+        fprintf(stderr, " and 1 useless rule removed\n");
+    else
+        fprintf(stderr, " and %d useless rules removed\n", nrules - nuseful);
+
+    nsyms -= nuseless;
+    nvars -= nuseless;
+    nrules = nuseful;
+    FREE(map);
+}
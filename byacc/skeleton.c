@@ -11,43 +11,1717 @@
 /*  useful in subsequent code.  The macros #defined in the header or    */
 /*  the body either are not useful outside of semantic actions or       */
 /*  are conditional.                                                    */
+/*                                                                      */
+/*  The C++ parser is a header, y.tab.hh, which may be included more    */
+/*  than once; it gets no yysccsid, which would be defined each time.   */
+
+char *sccsid[] =
+{
+    "#ifndef lint",
+    "static char yysccsid[] = \"@(#)yaccpar     1.9 (Berkeley) 02/21/93\";",
+    "#endif",
+    0
+};
+
+
+char *banner[] =
+{
+    "#define YYBYACC 1",
+    "#define YYMAJOR 1",
+    "#define YYMINOR 9",
+    "#define yyclearin (yychar=(-1))",
+    "#define yyerrok (yyerrflag=0)",
+    "#define YYRECOVERING (yyerrflag!=0)",
+    0
+};
+
+
+char *tables[] =
+{
+    "extern short yylhs[];",
+    "extern short yylen[];",
+    "extern short yydefred[];",
+    "extern short yydgoto[];",
+    "extern short yysindex[];",
+    "extern short yyrindex[];",
+    "extern short yygindex[];",
+    "extern short yytable[];",
+    "extern short yycheck[];",
+    "extern short yyerrdepth[];",
+    "extern short yytranslate[];",
+    "#if YYDEBUG",
+    "extern char *yyname[];",
+    "extern char *yyrule[];",
+    "#endif",
+    0
+};
+
+
+/*  With --const-tables, the tables are slices of the single array      */
+/*  yytables, and the names are string blobs indexed by offset arrays   */
+/*  (see start_table and output_debug in output.c).                     */
+
+char *const_tables[] =
+{
+    "extern const short yytables[];",
+    "#if YYDEBUG",
+    "extern const char yynames[];",
+    "extern const int yynameindex[];",
+    "extern const char yyrules[];",
+    "extern const int yyruleindex[];",
+    "#endif",
+    0
+};
+
+
+char *header[] =
+{
+    "#ifdef YYSTACKSIZE",
+    "#undef YYMAXDEPTH",
+    "#define YYMAXDEPTH YYSTACKSIZE",
+    "#else",
+    "#ifdef YYMAXDEPTH",
+    "#define YYSTACKSIZE YYMAXDEPTH",
+    "#else",
+    "#define YYSTACKSIZE 500",
+    "#define YYMAXDEPTH 500",
+    "#endif",
+    "#endif",
+    "int yydebug;",
+    "#if YYSTATS",
+    "#include <stdio.h>",
+    "#include <string.h>",
+    "#include <time.h>",
+    "#ifndef YYSTATSCLOCK",
+    "#define YYSTATSCLOCK() clock()",
+    "#endif",
+    "struct yystats",
+    "{",
+    "    long parses;",
+    "    long shifts;",
+    "    long recoveries;",
+    "    long maxdepth;",
+    "    long states;",
+    "    long reductions[YYNRULES];",
+    "};",
+    "#endif",
+    "#if YYPROFILE",
+    "#include <stdio.h>",
+    "#include <string.h>",
+    "#endif",
+    "#if YYTRACE",
+    "#include <stdio.h>",
+    "#ifndef YYTRACESIZE",
+    "#define YYTRACESIZE 1024",
+    "#endif",
+    "#define YYTR_READ 1",
+    "#define YYTR_SHIFT 2",
+    "#define YYTR_REDUCE 3",
+    "#define YYTR_GOTO 4",
+    "#define YYTR_ERROR 5",
+    "#define YYTR_RECOVER 6",
+    "#define YYTR_POP 7",
+    "#define YYTR_DISCARD 8",
+    "#define YYTR_ACCEPT 9",
+    "#define YYTR_ABORT 10",
+    "struct yytrace",
+    "{",
+    "    unsigned char event;",
+    "    short state;",
+    "    short token;",
+    "    short rule;",
+    "};",
+    "#endif",
+    "#define yystacksize YYSTACKSIZE",
+    "#if YYTOKENCLASSES",
+    "#define YYCLASS(c) ((c) <= YYMAXTOKEN ? yytranslate[c] : 0)",
+    "#else",
+    "#define YYCLASS(c) (c)",
+    "#define YYERRCLASS YYERRCODE",
+    "#endif",
+    "#if YYBUDGET",
+    "#define YYEXHAUSTED 5",
+    "#ifndef YYBUDGETINTERVAL",
+    "#define YYBUDGETINTERVAL 1024",
+    "#endif",
+    "#ifndef YYCLOCK",
+    "#include <time.h>",
+    "static long",
+    "yyclock()",
+    "{",
+    "    struct timespec yyt;",
+    "",
+    "    clock_gettime(CLOCK_MONOTONIC, &yyt);",
+    "    return (yyt.tv_sec * 1000000000L + yyt.tv_nsec);",
+    "}",
+    "#define YYCLOCK() yyclock()",
+    "#endif",
+    "#endif",
+    0
+};
+
+
+/*  The parser keeps its state in global variables, unless --reentrant  */
+/*  is given; then the state is kept in a struct yyhandle, and the      */
+/*  functions that set up a handle follow it.  Only one of the two is   */
+/*  written (see output_header in output.c).                            */
+
+char *globals[] =
+{
+    "int yynerrs;",
+    "int yyerrflag;",
+    "int yychar;",
+    "short *yyssp;",
+    "#if YYTYPEDSTACK",
+    "char *yyvsp;",
+    "#else",
+    "YYSTYPE *yyvsp;",
+    "#endif",
+    "YYSTYPE yyval;",
+    "YYSTYPE yylval;",
+    "short yyss[YYSTACKSIZE];",
+    "#if YYLEXINPLACE",
+    "YYSTYPE yyvs[YYSTACKSIZE + 2];",
+    "#else",
+    "YYSTYPE yyvs[YYSTACKSIZE];",
+    "#endif",
+    "#if YYLEXINPLACE",
+    "#define YYLEX yylex(yyvsp + 1)",
+    "#else",
+    "#define YYLEX yylex()",
+    "#endif",
+    "#define YYERRORCALL(msg) yyerror(msg)",
+    "#if YYBUDGET",
+    "long yysteps;",
+    "long yydeadline;",
+    "#endif",
+    "#if YYSTATS",
+    "struct yystats yystats;",
+    "#endif",
+    "#define YYSTATSREC yystats",
+    "#if YYTRACE",
+    "struct yytrace yytracebuf[YYTRACESIZE];",
+    "unsigned long yytracepos;",
+    "#endif",
+    "#define YYTRACEBUF yytracebuf",
+    "#define YYTRACEPOS yytracepos",
+    "#define YYTRACEADD(e, s, t, r) yytraceadd(e, s, t, r)",
+    "#if YYPROFILE",
+    "long yyprofstates[YYNSTATES];",
+    "long yyproftokens[YYNSTATES][YYMAXTOKEN + 2];",
+    "#endif",
+    "#define YYPROFSTATES yyprofstates",
+    "#define YYPROFTOKENS yyproftokens",
+    "#if YYINCREMENTAL",
+    "#error \"YYINCREMENTAL requires --reentrant\"",
+    "#endif",
+    "#if YYBUDGET",
+    "#define YYSTEPS yysteps",
+    "#define YYDEADLINE yydeadline",
+    "#endif",
+    0
+};
+
+
+char *handle[] =
+{
+    "struct yyhandle",
+    "{",
+    "    int yynerrs;",
+    "    int yyerrflag;",
+    "    int yychar;",
+    "    short *yyssp;",
+    "#if YYTYPEDSTACK",
+    "    char *yyvsp;",
+    "#else",
+    "    YYSTYPE *yyvsp;",
+    "#endif",
+    "    YYSTYPE yylval;",
+    "    void *yyinput;",
+    "    struct yysnapshot *yysnap;",
+    "#if YYBUDGET",
+    "    long yysteps;",
+    "    long yydeadline;",
+    "#endif",
+    "#if YYINCREMENTAL",
+    "    int yyinterval;",
+    "    int yycountdown;",
+    "    struct yycheckpoint *yychecks;",
+    "    int yynchecks;",
+    "    int yymaxchecks;",
+    "    int yyoldnext;",
+    "    int yyoldend;",
+    "    long yydelta;",
+    "    long yyeditend;",
+    "#endif",
+    "#if YYSTATS",
+    "    struct yystats yystats;",
+    "#endif",
+    "#if YYTRACE",
+    "    unsigned long yytracepos;",
+    "    struct yytrace yytracebuf[YYTRACESIZE];",
+    "#endif",
+    "#if YYPROFILE",
+    "    long yyprofstates[YYNSTATES];",
+    "    long yyproftokens[YYNSTATES][YYMAXTOKEN + 2];",
+    "#endif",
+    "    short yyss[YYSTACKSIZE];",
+    "#if YYLEXINPLACE",
+    "    YYSTYPE yyvs[YYSTACKSIZE + 2];",
+    "#else",
+    "    YYSTYPE yyvs[YYSTACKSIZE];",
+    "#endif",
+    "};",
+    "#define YYSUSPEND (-2)",
+    "#define YYSUSPENDED 2",
+    "#define YYSPECFAIL 3",
+    "#define YYREJOINED 4",
+    "#if YYLEXINPLACE",
+    "#define YYLEX yylex(yyvsp + 1, yyh->yyinput)",
+    "#else",
+    "#define YYLEX yylex(&yylval, yyh->yyinput)",
+    "#endif",
+    "#define YYERRORCALL(msg) yyerror(msg, yyh->yyinput)",
+    "#define YYINPUT (yyh->yyinput)",
+    "#define YYSTATSREC (yyh->yystats)",
+    "#define YYTRACEBUF (yyh->yytracebuf)",
+    "#define YYTRACEPOS (yyh->yytracepos)",
+    "#define YYTRACEADD(e, s, t, r) yytraceadd(yyh, e, s, t, r)",
+    "#define YYPROFSTATES (yyh->yyprofstates)",
+    "#define YYPROFTOKENS (yyh->yyproftokens)",
+    "#if YYBUDGET",
+    "#define YYSTEPS yyh->yysteps",
+    "#define YYDEADLINE yyh->yydeadline",
+    "#endif",
+    0
+};
+
+
+/*  With YYINCREMENTAL, a reentrant parser keeps copies of its stacks   */
+/*  as it reads the input, from which it can reparse after an edit.     */
+
+char *incremental[] =
+{
+    "#if YYINCREMENTAL",
+    "#if YYTYPEDSTACK",
+    "#error \"YYINCREMENTAL cannot be used with --typed-stack\"",
+    "#endif",
+    "#include <stdlib.h>",
+    "#include <string.h>",
+    "struct yycheckpoint",
+    "{",
+    "    long yyoffset;",
+    "    int yydepth;",
+    "    int yyerrflag;",
+    "    int yynerrs;",
+    "    short *yyss;",
+    "    YYSTYPE *yyvs;",
+    "};",
+    "static void",
+    "yyfreechecks(yyh, from, to)",
+    "struct yyhandle *yyh;",
+    "int from, to;",
+    "{",
+    "    while (from < to)",
+    "        free((char *) yyh->yychecks[from++].yyvs);",
+    "}",
+    "void",
+    "yyparse_checkpoints(yyh, interval)",
+    "struct yyhandle *yyh;",
+    "int interval;",
+    "{",
+    "    yyfreechecks(yyh, 0, yyh->yynchecks);",
+    "    yyfreechecks(yyh, yyh->yyoldnext, yyh->yyoldend);",
+    "    if (interval <= 0 && yyh->yychecks)",
+    "    {",
+    "        free((char *) yyh->yychecks);",
+    "        yyh->yychecks = 0;",
+    "        yyh->yymaxchecks = 0;",
+    "    }",
+    "    yyh->yynchecks = 0;",
+    "    yyh->yyoldnext = yyh->yyoldend = yyh->yymaxchecks;",
+    "    yyh->yyinterval = interval > 0 ? interval : 0;",
+    "    yyh->yycountdown = yyh->yyinterval;",
+    "}",
+    "static void",
+    "yyrecord(yyh, offset)",
+    "register struct yyhandle *yyh;",
+    "long offset;",
+    "{",
+    "    register struct yycheckpoint *yyc;",
+    "    register int yyn, yyold, yydepth;",
+    "",
+    "    if (yyh->yynchecks == yyh->yyoldnext)",
+    "    {",
+    "        yyn = yyh->yymaxchecks ? 2 * yyh->yymaxchecks : 16;",
+    "        yyc = (struct yycheckpoint *) realloc((char *) yyh->yychecks,",
+    "                yyn * sizeof(struct yycheckpoint));",
+    "        if (yyc == 0) return;",
+    "        yyold = yyh->yyoldend - yyh->yyoldnext;",
+    "        if (yyold)",
+    "            memmove(yyc + yyn - yyold, yyc + yyh->yyoldnext,",
+    "                    yyold * sizeof(struct yycheckpoint));",
+    "        yyh->yychecks = yyc;",
+    "        yyh->yymaxchecks = yyn;",
+    "        yyh->yyoldnext = yyn - yyold;",
+    "        yyh->yyoldend = yyn;",
+    "    }",
+    "    yydepth = yyh->yyssp - yyh->yyss;",
+    "    yyc = &yyh->yychecks[yyh->yynchecks];",
+    "    yyc->yyvs = (YYSTYPE *) malloc((yydepth + 1) *",
+    "            (sizeof(YYSTYPE) + sizeof(short)));",
+    "    if (yyc->yyvs == 0) return;",
+    "    yyc->yyss = (short *) (yyc->yyvs + yydepth + 1);",
+    "    memcpy(yyc->yyvs, yyh->yyvs, (yydepth + 1) * sizeof(YYSTYPE));",
+    "    memcpy(yyc->yyss, yyh->yyss, (yydepth + 1) * sizeof(short));",
+    "    yyc->yyoffset = offset;",
+    "    yyc->yydepth = yydepth;",
+    "    yyc->yyerrflag = yyh->yyerrflag;",
+    "    yyc->yynerrs = yyh->yynerrs;",
+    "    ++yyh->yynchecks;",
+    "}",
+    "static int",
+    "yymark(yyh)",
+    "register struct yyhandle *yyh;",
+    "{",
+    "    register struct yycheckpoint *yyc;",
+    "    register int yyi, yydepth;",
+    "    long yyoffset;",
+    "",
+    "    yyoffset = YYOFFSET(yyh->yyinput);",
+    "    if (yyh->yyoldnext < yyh->yyoldend && yyoffset >= yyh->yyeditend)",
+    "    {",
+    "        while (yyh->yyoldnext < yyh->yyoldend &&",
+    "                yyh->yychecks[yyh->yyoldnext].yyoffset + yyh->yydelta <",
+    "                yyoffset)",
+    "            free((char *) yyh->yychecks[yyh->yyoldnext++].yyvs);",
+    "        yyc = &yyh->yychecks[yyh->yyoldnext];",
+    "        yydepth = yyh->yyssp - yyh->yyss;",
+    "        if (yyh->yyoldnext < yyh->yyoldend &&",
+    "                yyc->yyoffset + yyh->yydelta == yyoffset &&",
+    "                yyc->yydepth == yydepth &&",
+    "                yyc->yyerrflag == yyh->yyerrflag &&",
+    "                memcmp(yyc->yyss, yyh->yyss, (yydepth + 1) * sizeof(short))",
+    "                == 0)",
+    "        {",
+    "            free((char *) yyc->yyvs);",
+    "            ++yyh->yyoldnext;",
+    "            yyrecord(yyh, yyoffset);",
+    "            for (yyi = yyh->yyoldnext; yyi < yyh->yyoldend; ++yyi)",
+    "            {",
+    "                yyh->yychecks[yyi].yyoffset += yyh->yydelta;",
+    "                yyh->yychecks[yyh->yynchecks++] = yyh->yychecks[yyi];",
+    "            }",
+    "            yyh->yyoldnext = yyh->yyoldend = yyh->yymaxchecks;",
+    "            yyh->yycountdown = yyh->yyinterval;",
+    "            return (1);",
+    "        }",
+    "    }",
+    "    if (yyh->yycountdown <= 0)",
+    "    {",
+    "        yyrecord(yyh, yyoffset);",
+    "        yyh->yycountdown = yyh->yyinterval;",
+    "    }",
+    "    return (0);",
+    "}",
+    "long",
+    "yyparse_edit(yyh, offset, oldend, newend)",
+    "register struct yyhandle *yyh;",
+    "long offset, oldend, newend;",
+    "{",
+    "    register struct yycheckpoint *yyc;",
+    "    register int yyi, yylo, yyhi, yyn;",
+    "",
+    "    yyfreechecks(yyh, yyh->yyoldnext, yyh->yyoldend);",
+    "    yylo = 0;",
+    "    yyhi = yyh->yynchecks;",
+    "    while (yylo < yyhi)",
+    "    {",
+    "        yyi = (yylo + yyhi) / 2;",
+    "        if (yyh->yychecks[yyi].yyoffset < offset)",
+    "            yylo = yyi + 1;",
+    "        else",
+    "            yyhi = yyi;",
+    "    }",
+    "    yyn = yyh->yynchecks - yylo;",
+    "    if (yyn)",
+    "        memmove(yyh->yychecks + yyh->yymaxchecks - yyn, yyh->yychecks + yylo,",
+    "                yyn * sizeof(struct yycheckpoint));",
+    "    yyh->yynchecks = yylo;",
+    "    yyh->yyoldnext = yyh->yymaxchecks - yyn;",
+    "    yyh->yyoldend = yyh->yymaxchecks;",
+    "    yyh->yydelta = newend - oldend;",
+    "    yyh->yyeditend = newend;",
+    "    yyh->yycountdown = yyh->yyinterval;",
+    "    yyh->yychar = (-1);",
+    "    yyh->yysnap = 0;",
+    "    if (yylo == 0)",
+    "    {",
+    "        yyh->yyssp = yyh->yyss;",
+    "        yyh->yyvsp = yyh->yyvs;",
+    "        *yyh->yyssp = 0;",
+    "        yyh->yyerrflag = 0;",
+    "        yyh->yynerrs = 0;",
+    "        return (0);",
+    "    }",
+    "    yyc = &yyh->yychecks[yylo - 1];",
+    "    memcpy(yyh->yyss, yyc->yyss, (yyc->yydepth + 1) * sizeof(short));",
+    "    memcpy(yyh->yyvs, yyc->yyvs, (yyc->yydepth + 1) * sizeof(YYSTYPE));",
+    "    yyh->yyssp = yyh->yyss + yyc->yydepth;",
+    "    yyh->yyvsp = yyh->yyvs + yyc->yydepth;",
+    "    yyh->yyerrflag = yyc->yyerrflag;",
+    "    yyh->yynerrs = yyc->yynerrs;",
+    "    return (yyc->yyoffset);",
+    "}",
+    "#endif",
+    0
+};
+
+
+char *handle_functions[] =
+{
+    "#include <stdlib.h>",
+    "void",
+    "yyparse_reset(yyh, input)",
+    "struct yyhandle *yyh;",
+    "void *input;",
+    "{",
+    "    yyh->yynerrs = 0;",
+    "    yyh->yyerrflag = 0;",
+    "    yyh->yychar = (-1);",
+    "    yyh->yyinput = input;",
+    "    yyh->yysnap = 0;",
+    "#if YYINCREMENTAL",
+    "    if (yyh->yyinterval) yyparse_checkpoints(yyh, yyh->yyinterval);",
+    "#endif",
+    "    yyh->yyssp = yyh->yyss;",
+    "#if YYTYPEDSTACK",
+    "    yyh->yyvsp = (char *) yyh->yyvs;",
+    "#else",
+    "    yyh->yyvsp = yyh->yyvs;",
+    "#endif",
+    "    *yyh->yyssp = 0;",
+    "}",
+    "#if YYBUDGET",
+    "void",
+    "yyparse_budget(yyh, steps, deadline)",
+    "struct yyhandle *yyh;",
+    "long steps, deadline;",
+    "{",
+    "    yyh->yysteps = steps;",
+    "    yyh->yydeadline = deadline;",
+    "}",
+    "#endif",
+    "void",
+    "yyparse_init(yyh, input)",
+    "struct yyhandle *yyh;",
+    "void *input;",
+    "{",
+    "#if YYDEBUG",
+    "    static int yyinit;",
+    "    register char *yys;",
+    "    register int yyn;",
+    "    extern char *getenv();",
+    "",
+    "    if (!yyinit)",
+    "    {",
+    "        yyinit = 1;",
+    "        if (yys = getenv(\"YYDEBUG\"))",
+    "        {",
+    "            yyn = *yys;",
+    "            if (yyn >= '0' && yyn <= '9')",
+    "                yydebug = yyn - '0';",
+    "        }",
+    "    }",
+    "#endif",
+    "#if YYINCREMENTAL",
+    "    yyh->yyinterval = 0;",
+    "    yyh->yychecks = 0;",
+    "    yyh->yynchecks = yyh->yymaxchecks = 0;",
+    "    yyh->yyoldnext = yyh->yyoldend = 0;",
+    "#endif",
+    "#if YYBUDGET",
+    "    yyh->yysteps = 0;",
+    "    yyh->yydeadline = 0;",
+    "#endif",
+    "#if YYSTATS",
+    "    memset((char *) &yyh->yystats, 0, sizeof(yyh->yystats));",
+    "#endif",
+    "#if YYTRACE",
+    "    yyh->yytracepos = 0;",
+    "#endif",
+    "#if YYPROFILE",
+    "    memset((char *) yyh->yyprofstates, 0, sizeof(yyh->yyprofstates));",
+    "    memset((char *) yyh->yyproftokens, 0, sizeof(yyh->yyproftokens));",
+    "#endif",
+    "    yyparse_reset(yyh, input);",
+    "}",
+    "struct yyhandle *",
+    "yyparse_alloc(input)",
+    "void *input;",
+    "{",
+    "    register struct yyhandle *yyh;",
+    "",
+    "    yyh = (struct yyhandle *) malloc(sizeof(struct yyhandle));",
+    "    if (yyh) yyparse_init(yyh, input);",
+    "    return (yyh);",
+    "}",
+    "void",
+    "yyparse_free(yyh)",
+    "struct yyhandle *yyh;",
+    "{",
+    "    if (yyh == 0) return;",
+    "#if YYINCREMENTAL",
+    "    yyparse_checkpoints(yyh, 0);",
+    "#endif",
+    "    free((char *) yyh);",
+    "}",
+    0
+};
+
+/*  The snapshots of a reentrant parser, which are not available with   */
+/*  --typed-stack.                                                      */
+
+char *snapshots[] =
+{
+    "struct yysnapshot",
+    "{",
+    "    struct yysnapshot *yyolder;",
+    "    int yydepth;",
+    "    int yylow;",
+    "    int yychar;",
+    "    int yyerrflag;",
+    "    int yynerrs;",
+    "    YYSTYPE yylval;",
+    "    short yyss[YYSTACKSIZE];",
+    "#if YYLEXINPLACE",
+    "    YYSTYPE yyvs[YYSTACKSIZE + 2];",
+    "#else",
+    "    YYSTYPE yyvs[YYSTACKSIZE];",
+    "#endif",
+    "};",
+    "void",
+    "yyparse_snapshot(yyh, yys)",
+    "struct yyhandle *yyh;",
+    "struct yysnapshot *yys;",
+    "{",
+    "    yys->yydepth = yys->yylow = yyh->yyssp - yyh->yyss;",
+    "    yys->yychar = yyh->yychar;",
+    "    if (yyh->yychar >= 0)",
+    "#if YYLEXINPLACE",
+    "        yys->yylval = yyh->yyvsp[1];",
+    "#else",
+    "        yys->yylval = yyh->yylval;",
+    "#endif",
+    "    yys->yyerrflag = yyh->yyerrflag;",
+    "    yys->yynerrs = yyh->yynerrs;",
+    "    yys->yyolder = yyh->yysnap;",
+    "    yyh->yysnap = yys;",
+    "}",
+    "void",
+    "yyparse_restore(yyh, yys)",
+    "struct yyhandle *yyh;",
+    "struct yysnapshot *yys;",
+    "{",
+    "    register int yyi;",
+    "",
+    "    for (yyi = yys->yylow + 1; yyi <= yys->yydepth; ++yyi)",
+    "    {",
+    "        yyh->yyss[yyi] = yys->yyss[yyi];",
+    "        yyh->yyvs[yyi] = yys->yyvs[yyi];",
+    "    }",
+    "    yys->yylow = yys->yydepth;",
+    "    yyh->yyssp = yyh->yyss + yys->yydepth;",
+    "    yyh->yyvsp = yyh->yyvs + yys->yydepth;",
+    "    yyh->yychar = yys->yychar;",
+    "    if (yys->yychar >= 0)",
+    "#if YYLEXINPLACE",
+    "        yyh->yyvsp[1] = yys->yylval;",
+    "#else",
+    "        yyh->yylval = yys->yylval;",
+    "#endif",
+    "    yyh->yyerrflag = yys->yyerrflag;",
+    "    yyh->yynerrs = yys->yynerrs;",
+    "    yyh->yysnap = yys;",
+    "}",
+    "void",
+    "yyparse_release(yyh, yys)",
+    "struct yyhandle *yyh;",
+    "struct yysnapshot *yys;",
+    "{",
+    "    yyh->yysnap = yys->yyolder;",
+    "}",
+    "static int",
+    "yysave(yyh, depth)",
+    "struct yyhandle *yyh;",
+    "int depth;",
+    "{",
+    "    register struct yysnapshot *yys;",
+    "    register int yyi;",
+    "",
+    "    for (yys = yyh->yysnap; yys && yys->yylow > depth; yys = yys->yyolder)",
+    "    {",
+    "        for (yyi = depth + 1; yyi <= yys->yylow; ++yyi)",
+    "        {",
+    "            yys->yyss[yyi] = yyh->yyss[yyi];",
+    "            yys->yyvs[yyi] = yyh->yyvs[yyi];",
+    "        }",
+    "        yys->yylow = depth;",
+    "    }",
+    "    return (depth);",
+    "}",
+    0
+};
+
+/*  The thread pool of yyparse_batch, which yyparse_chunks shares.      */
+
+char *batch[] =
+{
+    "#if YYBATCH || YYCHUNKS",
+    "#if YYSTATS || YYTRACE || YYPROFILE",
+    "#error \"YYBATCH and YYCHUNKS exclude YYSTATS, YYTRACE and YYPROFILE\"",
+    "#endif",
+    "#include <stdlib.h>",
+    "#include <string.h>",
+    "#include <pthread.h>",
+    "int yyparse();",
+    "struct yyworker",
+    "{",
+    "    struct yyhandle yyh;",
+    "    pthread_t yythread;",
+    "    pthread_mutex_t yylock;",
+    "    int yynext;",
+    "    int yyend;",
+    "    int yynworkers;",
+    "    struct yyworker *yyworkers;",
+    "    int (*yyjob)();",
+    "    void **yyinputs;",
+    "    int *yyresults;",
+    "    struct yyhandle **yysaved;",
+    "};",
+    "static int",
+    "yysteal(yyw)",
+    "register struct yyworker *yyw;",
+    "{",
+    "    register struct yyworker *yyv, *yymax;",
+    "    register int yyi, yyn, yyend;",
+    "",
+    "    pthread_mutex_lock(&yyw->yylock);",
+    "    yyi = yyw->yynext < yyw->yyend ? yyw->yynext++ : -1;",
+    "    pthread_mutex_unlock(&yyw->yylock);",
+    "    if (yyi >= 0) return (yyi);",
+    "    for (;;)",
+    "    {",
+    "        yymax = 0;",
+    "        yyn = 0;",
+    "        for (yyv = yyw->yyworkers; yyv < yyw->yyworkers + yyw->yynworkers;",
+    "                ++yyv)",
+    "        {",
+    "            pthread_mutex_lock(&yyv->yylock);",
+    "            if (yyv->yyend - yyv->yynext > yyn)",
+    "            {",
+    "                yyn = yyv->yyend - yyv->yynext;",
+    "                yymax = yyv;",
+    "            }",
+    "            pthread_mutex_unlock(&yyv->yylock);",
+    "        }",
+    "        if (yymax == 0) return (-1);",
+    "        pthread_mutex_lock(&yymax->yylock);",
+    "        yyn = yymax->yyend - yymax->yynext;",
+    "        if (yyn > 0)",
+    "        {",
+    "            yyend = yymax->yyend;",
+    "            yyi = yyend - (yyn + 1) / 2;",
+    "            yymax->yyend = yyi;",
+    "            pthread_mutex_unlock(&yymax->yylock);",
+    "            pthread_mutex_lock(&yyw->yylock);",
+    "            yyw->yynext = yyi + 1;",
+    "            yyw->yyend = yyend;",
+    "            pthread_mutex_unlock(&yyw->yylock);",
+    "            return (yyi);",
+    "        }",
+    "        pthread_mutex_unlock(&yymax->yylock);",
+    "    }",
+    "}",
+    "static void *",
+    "yywork(arg)",
+    "void *arg;",
+    "{",
+    "    register struct yyworker *yyw;",
+    "    register int yyi;",
+    "",
+    "    yyw = (struct yyworker *) arg;",
+    "    while ((yyi = yysteal(yyw)) >= 0)",
+    "        yyw->yyresults[yyi] = (*yyw->yyjob)(yyw, yyi);",
+    "    return (0);",
+    "}",
+    "static int",
+    "yyrun(job, inputs, results, saved, n, nthreads)",
+    "int (*job)();",
+    "void **inputs;",
+    "int *results;",
+    "struct yyhandle **saved;",
+    "int n, nthreads;",
+    "{",
+    "    register struct yyworker *yyw;",
+    "    register int yyi, yyk;",
+    "",
+    "    if (nthreads < 1) nthreads = 1;",
+    "    if (nthreads > n) nthreads = n;",
+    "    if (nthreads < 1) return (0);",
+    "    yyw = (struct yyworker *) malloc(nthreads * sizeof(struct yyworker));",
+    "    if (yyw == 0) return (-1);",
+    "    for (yyi = 0; yyi < nthreads; ++yyi)",
+    "    {",
+    "        yyparse_init(&yyw[yyi].yyh, (void *) 0);",
+    "        pthread_mutex_init(&yyw[yyi].yylock, (pthread_mutexattr_t *) 0);",
+    "        yyw[yyi].yynext = (long) n * yyi / nthreads;",
+    "        yyw[yyi].yyend = (long) n * (yyi + 1) / nthreads;",
+    "        yyw[yyi].yynworkers = nthreads;",
+    "        yyw[yyi].yyworkers = yyw;",
+    "        yyw[yyi].yyjob = job;",
+    "        yyw[yyi].yyinputs = inputs;",
+    "        yyw[yyi].yyresults = results;",
+    "        yyw[yyi].yysaved = saved;",
+    "    }",
+    "    for (yyk = 1; yyk < nthreads; ++yyk)",
+    "        if (pthread_create(&yyw[yyk].yythread, (pthread_attr_t *) 0, yywork,",
+    "                (void *) &yyw[yyk]))",
+    "            break;",
+    "    yywork((void *) yyw);",
+    "    for (yyi = 1; yyi < yyk; ++yyi)",
+    "        pthread_join(yyw[yyi].yythread, (void **) 0);",
+    "    for (yyi = 0; yyi < nthreads; ++yyi)",
+    "        pthread_mutex_destroy(&yyw[yyi].yylock);",
+    "    free((char *) yyw);",
+    "    return (0);",
+    "}",
+    "#endif",
+    "#if YYBATCH",
+    "static int",
+    "yybatchjob(yyw, yyi)",
+    "register struct yyworker *yyw;",
+    "int yyi;",
+    "{",
+    "    yyparse_reset(&yyw->yyh, yyw->yyinputs[yyi]);",
+    "    return (yyparse(&yyw->yyh));",
+    "}",
+    "int",
+    "yyparse_batch(inputs, results, n, nthreads)",
+    "void **inputs;",
+    "int *results;",
+    "int n, nthreads;",
+    "{",
+    "    return (yyrun(yybatchjob, inputs, results, (struct yyhandle **) 0, n,",
+    "            nthreads));",
+    "}",
+    "#endif",
+    0
+};
+
+/*  The parse of an input cut into chunks, on the thread pool of        */
+/*  yyparse_batch.                                                      */
+
+char *chunks[] =
+{
+    "#if YYCHUNKS",
+    "#ifndef YYREWIND",
+    "#error \"YYCHUNKS requires YYREWIND(input)\"",
+    "#endif",
+    "#define YYRESTARTED(h) ((h)->yyssp == (h)->yyss + 1 && \\",
+    "        (h)->yyss[1] == YYFINAL && (h)->yyerrflag == 0 && (h)->yychar < 0)",
+    "static struct yyhandle *",
+    "yysavehandle(yyh)",
+    "register struct yyhandle *yyh;",
+    "{",
+    "    register struct yyhandle *yyc;",
+    "",
+    "    yyc = (struct yyhandle *) malloc(sizeof(struct yyhandle));",
+    "    if (yyc == 0) return (0);",
+    "    memcpy((char *) yyc, (char *) yyh, sizeof(struct yyhandle));",
+    "    yyc->yyssp = yyc->yyss + (yyh->yyssp - yyh->yyss);",
+    "#if YYTYPEDSTACK",
+    "    yyc->yyvsp = (char *) yyc->yyvs + (yyh->yyvsp - (char *) yyh->yyvs);",
+    "#else",
+    "    yyc->yyvsp = yyc->yyvs + (yyh->yyvsp - yyh->yyvs);",
+    "#endif",
+    "    return (yyc);",
+    "}",
+    "static int",
+    "yychunkjob(yyw, yyi)",
+    "register struct yyworker *yyw;",
+    "int yyi;",
+    "{",
+    "    register struct yyhandle *yyh;",
+    "    register int yyn;",
+    "",
+    "    yyh = &yyw->yyh;",
+    "    yyparse_reset(yyh, yyw->yyinputs[yyi]);",
+    "    if (yyi > 0)",
+    "    {",
+    "        *++yyh->yyssp = YYFINAL;",
+    "#if YYTYPEDSTACK",
+    "        memset(yyh->yyvsp, 0, yyvsize[YYFINAL]);",
+    "        yyh->yyvsp += yyvsize[YYFINAL];",
+    "#else",
+    "        memset((char *) ++yyh->yyvsp, 0, sizeof(YYSTYPE));",
+    "#endif",
+    "    }",
+    "    yyn = yyparse(yyh);",
+    "    if (yyn == YYSUSPENDED && !YYRESTARTED(yyh))",
+    "    {",
+    "        yyw->yysaved[yyi] = yysavehandle(yyh);",
+    "        if (yyw->yysaved[yyi] == 0) return (-1);",
+    "    }",
+    "    return (yyn);",
+    "}",
+    "int",
+    "yyparse_chunks(inputs, results, n, nthreads)",
+    "void **inputs;",
+    "int *results;",
+    "int n, nthreads;",
+    "{",
+    "    register struct yyhandle **yysaved, *yyc;",
+    "    register int yyi, yyn;",
+    "",
+    "    if (n < 1) return (1);",
+    "    yysaved = (struct yyhandle **) calloc(n, sizeof(struct yyhandle *));",
+    "    if (yysaved == 0) return (-1);",
+    "    if (yyrun(yychunkjob, inputs, results, yysaved, n, nthreads) < 0)",
+    "    {",
+    "        free((char *) yysaved);",
+    "        return (-1);",
+    "    }",
+    "    yyc = 0;",
+    "    for (yyi = 0; yyi < n; ++yyi)",
+    "    {",
+    "        if (yyc)",
+    "        {",
+    "            if (yysaved[yyi]) free((char *) yysaved[yyi]);",
+    "            YYREWIND(inputs[yyi]);",
+    "            yyc->yyinput = inputs[yyi];",
+    "            results[yyi] = yyparse(yyc);",
+    "            if (results[yyi] != YYSUSPENDED || YYRESTARTED(yyc))",
+    "            {",
+    "                free((char *) yyc);",
+    "                yyc = 0;",
+    "            }",
+    "        }",
+    "        else if (results[yyi] == YYSUSPENDED)",
+    "            yyc = yysaved[yyi];",
+    "        if (results[yyi] != YYSUSPENDED)",
+    "            break;",
+    "    }",
+    "    yyn = results[yyi < n ? yyi : n - 1];",
+    "    while (++yyi < n)",
+    "    {",
+    "        if (yysaved[yyi]) free((char *) yysaved[yyi]);",
+    "        results[yyi] = -1;",
+    "    }",
+    "    if (yyc) free((char *) yyc);",
+    "    free((char *) yysaved);",
+    "    return (yyn);",
+    "}",
+    "#endif",
+    0
+};
+
+
+/*  The functions of the options that are chosen when the parser is     */
+/*  compiled, each under the macro that enables it.                     */
+
+char *runtime[] =
+{
+    "#if YYEXPECTED",
+    "#define YYEXPECTS(state, token) \\",
+    "        (yyexpect[yyexprow[state]][(token) >> 3] >> ((token) & 7) & 1)",
+    "int",
+    "yyexpected(state, tokens, max)",
+    "int state;",
+    "int *tokens;",
+    "int max;",
+    "{",
+    "    register unsigned char *yyb;",
+    "    register int yyi, yyn;",
+    "",
+    "    yyb = yyexpect[yyexprow[state]];",
+    "    yyn = 0;",
+    "    for (yyi = 0; yyi < YYEXPECTBYTES * 8; ++yyi)",
+    "    {",
+    "        if (yyb[yyi >> 3] == 0)",
+    "            yyi |= 7;",
+    "        else if (yyb[yyi >> 3] >> (yyi & 7) & 1)",
+    "        {",
+    "            if (yyn < max) tokens[yyn] = yyi;",
+    "            ++yyn;",
+    "        }",
+    "    }",
+    "    return (yyn);",
+    "}",
+    "#endif",
+    "#if YYPROFILE",
+    "#ifndef YYCANONICAL",
+    "#define YYCANONICAL(s) (s)",
+    "#endif",
+    "int",
+    "#if YYREENTRANT",
+    "yyprofdump(yyh, fp)",
+    "struct yyhandle *yyh;",
+    "#else",
+    "yyprofdump(fp)",
+    "#endif",
+    "FILE *fp;",
+    "{",
+    "    register int i, j;",
+    "",
+    "    fprintf(fp, \"states %d\\n\", YYNSTATES);",
+    "    for (i = 0; i < YYNSTATES; ++i)",
+    "    {",
+    "        if (YYPROFSTATES[i])",
+    "            fprintf(fp, \"s %d %ld\\n\", YYCANONICAL(i), YYPROFSTATES[i]);",
+    "        for (j = 0; j <= YYMAXTOKEN + 1; ++j)",
+    "            if (YYPROFTOKENS[i][j])",
+    "                fprintf(fp, \"t %d %d %ld\\n\", YYCANONICAL(i), j,",
+    "                        YYPROFTOKENS[i][j]);",
+    "    }",
+    "    return (ferror(fp) ? -1 : 0);",
+    "}",
+    "#endif",
+    "#if YYSTATS",
+    "void (*yystatshook)();",
+    "int",
+    "#if YYREENTRANT",
+    "yystatsdump(yyh, fp)",
+    "struct yyhandle *yyh;",
+    "#else",
+    "yystatsdump(fp)",
+    "#endif",
+    "FILE *fp;",
+    "{",
+    "    register int i;",
+    "",
+    "    fprintf(fp, \"parses %ld\\nshifts %ld\\nrecoveries %ld\\n\",",
+    "            YYSTATSREC.parses, YYSTATSREC.shifts, YYSTATSREC.recoveries);",
+    "    fprintf(fp, \"maxdepth %ld\\nstates %ld\\n\",",
+    "            YYSTATSREC.maxdepth, YYSTATSREC.states);",
+    "    for (i = 0; i < YYNRULES; ++i)",
+    "        if (YYSTATSREC.reductions[i])",
+    "#if YYDEBUG",
+    "            fprintf(fp, \"rule %d %ld %s\\n\", i, YYSTATSREC.reductions[i],",
+    "                    YYRULE(i));",
+    "#else",
+    "            fprintf(fp, \"rule %d %ld\\n\", i, YYSTATSREC.reductions[i]);",
+    "#endif",
+    "    return (ferror(fp) ? -1 : 0);",
+    "}",
+    "#endif",
+    "#if YYTRACE",
+    "static void",
+    "#if YYREENTRANT",
+    "yytraceadd(yyh, event, state, token, rule)",
+    "struct yyhandle *yyh;",
+    "#else",
+    "yytraceadd(event, state, token, rule)",
+    "#endif",
+    "int event, state, token, rule;",
+    "{",
+    "    register struct yytrace *yyt;",
+    "",
+    "    yyt = &YYTRACEBUF[YYTRACEPOS++ % YYTRACESIZE];",
+    "    yyt->event = event;",
+    "    yyt->state = state;",
+    "    yyt->token = token <= YYMAXTOKEN ? token : YYMAXTOKEN + 1;",
+    "    yyt->rule = rule;",
+    "}",
+    "int",
+    "#if YYREENTRANT",
+    "yytracedump(yyh, fp)",
+    "struct yyhandle *yyh;",
+    "#else",
+    "yytracedump(fp)",
+    "#endif",
+    "FILE *fp;",
+    "{",
+    "    register unsigned long i;",
+    "    register struct yytrace *yyt;",
+    "",
+    "    i = YYTRACEPOS > YYTRACESIZE ? YYTRACEPOS - YYTRACESIZE : 0;",
+    "    for (; i < YYTRACEPOS; ++i)",
+    "    {",
+    "        yyt = &YYTRACEBUF[i % YYTRACESIZE];",
+    "        putc(yyt->event, fp);",
+    "        putc(0, fp);",
+    "        putc(yyt->state & 0xff, fp);",
+    "        putc((yyt->state >> 8) & 0xff, fp);",
+    "        putc(yyt->token & 0xff, fp);",
+    "        putc((yyt->token >> 8) & 0xff, fp);",
+    "        putc(yyt->rule & 0xff, fp);",
+    "        putc((yyt->rule >> 8) & 0xff, fp);",
+    "    }",
+    "    return (ferror(fp) ? -1 : 0);",
+    "}",
+    "#if YYDEBUG",
+    "int",
+    "yytracedecode(in, out)",
+    "FILE *in, *out;",
+    "{",
+    "    unsigned char r[8];",
+    "    register int state, token, rule;",
+    "    register char *s;",
+    "",
+    "    while (fread((char *) r, 1, 8, in) == 8)",
+    "    {",
+    "        state = (short) (r[2] | r[3] << 8);",
+    "        token = (short) (r[4] | r[5] << 8);",
+    "        rule = (short) (r[6] | r[7] << 8);",
+    "        s = 0;",
+    "        if (token >= 0 && token <= YYMAXTOKEN) s = YYNAME(token);",
+    "        if (!s) s = \"illegal-symbol\";",
+    "        switch (r[0])",
+    "        {",
+    "        case YYTR_READ:",
+    "            fprintf(out, \"state %d, reading %d (%s)\\n\", state, token, s);",
+    "            break;",
+    "        case YYTR_SHIFT:",
+    "            fprintf(out, \"shifting %d (%s) to state %d\\n\", token, s,",
+    "                    state);",
+    "            break;",
+    "        case YYTR_REDUCE:",
+    "            fprintf(out, \"state %d, reducing by rule %d (%s)\\n\", state,",
+    "                    rule, rule >= 0 && rule < YYNRULES ? YYRULE(rule) : \"?\");",
+    "            break;",
+    "        case YYTR_GOTO:",
+    "            fprintf(out, \"after reduction, going to state %d\\n\", state);",
+    "            break;",
+    "        case YYTR_ERROR:",
+    "            fprintf(out, \"state %d, syntax error at %d (%s)\\n\", state,",
+    "                    token, s);",
+    "            break;",
+    "        case YYTR_RECOVER:",
+    "            fprintf(out, \"error recovery shifting to state %d\\n\", state);",
+    "            break;",
+    "        case YYTR_POP:",
+    "            fprintf(out, \"error recovery discarding state %d\\n\", state);",
+    "            break;",
+    "        case YYTR_DISCARD:",
+    "            fprintf(out, \"state %d, error recovery discards token %d (%s)\\n\",",
+    "                    state, token, s);",
+    "            break;",
+    "        case YYTR_ACCEPT:",
+    "            fprintf(out, \"accept\\n\");",
+    "            break;",
+    "        case YYTR_ABORT:",
+    "            fprintf(out, \"abort in state %d\\n\", state);",
+    "            break;",
+    "        default:",
+    "            fprintf(out, \"unknown event %d\\n\", r[0]);",
+    "            break;",
+    "        }",
+    "    }",
+    "    return (ferror(out) ? -1 : 0);",
+    "}",
+    "#endif",
+    "#endif",
+    0
+};
+
+
+/*  The macros in jumps are used by the semantic actions when they are  */
+/*  written as the cases of the switch inside yyparse.  The macros in   */
+/*  returns are used instead when each action is written as a separate  */
+/*  function; the value returned by the function tells yyparse where    */
+/*  to jump (see call_action).                                          */
+
+char *jumps[] =
+{
+    "#define YYABORT goto yyabort",
+    "#define YYREJECT goto yyabort",
+    "#define YYACCEPT goto yyaccept",
+    "#define YYERROR goto yyerrlab",
+    0
+};
+
+
+char *returns[] =
+{
+    "#define YYABORT return (1)",
+    "#define YYREJECT return (1)",
+    "#define YYACCEPT return (2)",
+    "#define YYERROR return (3)",
+    0
+};
+
+
+char *body[] =
+{
+    "int",
+    "#if YYREENTRANT",
+    "yyparse(yyh)",
+    "struct yyhandle *yyh;",
+    "#else",
+    "yyparse()",
+    "#endif",
+    "{",
+    "    register int yym, yyn, yystate;",
+    "#if YYREENTRANT",
+    "    register short *yyssp;",
+    "#if YYTYPEDSTACK",
+    "    register char *yyvsp;",
+    "#else",
+    "    register YYSTYPE *yyvsp;",
+    "#endif",
+    "    short *yyss;",
+    "    int yychar, yyerrflag, yynerrs;",
+    "    YYSTYPE yyval, yylval;",
+    "#if YYSNAPSHOTS",
+    "    int yylow;",
+    "#endif",
+    "#endif",
+    "#if YYSTATS",
+    "    long yystart;",
+    "#endif",
+    "#if YYBUDGET",
+    "    long yyleft, yygrant;",
+    "#endif",
+    "#if YYDEBUG",
+    "    register char *yys;",
+    "#if !YYREENTRANT",
+    "    extern char *getenv();",
+    "",
+    "    if (yys = getenv(\"YYDEBUG\"))",
+    "    {",
+    "        yyn = *yys;",
+    "        if (yyn >= '0' && yyn <= '9')",
+    "            yydebug = yyn - '0';",
+    "    }",
+    "#endif",
+    "#endif",
+    "#if YYBUDGET",
+    "    yygrant = YYDEADLINE ? YYBUDGETINTERVAL : 0x7fffffffL;",
+    "    if (YYSTEPS && YYSTEPS < yygrant) yygrant = YYSTEPS < 0 ? 0 : YYSTEPS;",
+    "    yyleft = yygrant;",
+    "#endif",
+    "",
+    "#if YYREENTRANT",
+    "    yyss = yyh->yyss;",
+    "    yyssp = yyh->yyssp;",
+    "    yyvsp = yyh->yyvsp;",
+    "    yychar = yyh->yychar;",
+    "    if (yychar >= 0) yylval = yyh->yylval;",
+    "    yyerrflag = yyh->yyerrflag;",
+    "    yynerrs = yyh->yynerrs;",
+    "#if YYSNAPSHOTS",
+    "    yylow = yyh->yysnap ? yyh->yysnap->yylow : -1;",
+    "#endif",
+    "    yystate = *yyssp;",
+    "    if (yystate == YYFINAL) goto yyfinal;",
+    "#else",
+    "    yynerrs = 0;",
+    "    yyerrflag = 0;",
+    "    yychar = (-1);",
+    "",
+    "    yyssp = yyss;",
+    "#if YYTYPEDSTACK",
+    "    yyvsp = (char *) yyvs;",
+    "#else",
+    "    yyvsp = yyvs;",
+    "#endif",
+    "    *yyssp = yystate = 0;",
+    "#endif",
+    "#if YYSTATS",
+    "    yystart = yystatshook ? (long) YYSTATSCLOCK() : 0;",
+    "#endif",
+    "",
+    "yyloop:",
+    "#if YYBUDGET",
+    "    if (--yyleft < 0)",
+    "    {",
+    "        if (YYSTEPS > 0 && (YYSTEPS -= yygrant) <= 0) YYSTEPS = -1;",
+    "        yygrant = yyleft = 0;",
+    "        if (YYSTEPS < 0 || YYDEADLINE && YYCLOCK() >= YYDEADLINE)",
+    "            goto yyexhausted;",
+    "        yygrant = YYDEADLINE ? YYBUDGETINTERVAL : 0x7fffffffL;",
+    "        if (YYSTEPS > 0 && YYSTEPS < yygrant) yygrant = YYSTEPS;",
+    "        yyleft = yygrant - 1;",
+    "    }",
+    "#endif",
+    "#if YYPROFILE",
+    "    ++YYPROFSTATES[yystate];",
+    "#endif",
+    "#if YYSTATS",
+    "    ++YYSTATSREC.states;",
+    "    if (yyssp - yyss >= YYSTATSREC.maxdepth)",
+    "        YYSTATSREC.maxdepth = yyssp - yyss + 1;",
+    "#endif",
+    "#if YYINTERLEAVED",
+    "    if ((yyn = yystaterecs[yystate].defred) > 0) goto yyreduce;",
+    "#else",
+    "    if ((yyn = yydefred[yystate]) > 0) goto yyreduce;",
+    "#endif",
+    "    if (yychar < 0)",
+    "    {",
+    "#if YYREENTRANT",
+    "#if YYINCREMENTAL",
+    "        if (yyh->yyinterval && (--yyh->yycountdown <= 0 ||",
+    "                yyh->yyoldnext < yyh->yyoldend))",
+    "        {",
+    "            yyh->yyssp = yyssp;",
+    "            yyh->yyvsp = yyvsp;",
+    "            yyh->yyerrflag = yyerrflag;",
+    "            yyh->yynerrs = yynerrs;",
+    "            if (yymark(yyh))",
+    "            {",
+    "                yyn = YYREJOINED;",
+    "                goto yyreturn;",
+    "            }",
+    "        }",
+    "#endif",
+    "#endif",
+    "        if ((yychar = YYLEX) < 0)",
+    "        {",
+    "#if YYREENTRANT",
+    "            if (yychar == YYSUSPEND)",
+    "            {",
+    "                yychar = (-1);",
+    "                yyn = YYSUSPENDED;",
+    "                goto yyreturn;",
+    "            }",
+    "#endif",
+    "            yychar = 0;",
+    "        }",
+    "#if YYINTERLEAVED",
+    "        if (yychar > YYMAXTOKEN) yychar = YYMAXTOKEN + 1;",
+    "#endif",
+    "#if YYDEBUG",
+    "        if (yydebug)",
+    "        {",
+    "            yys = 0;",
+    "            if (yychar <= YYMAXTOKEN) yys = YYNAME(yychar);",
+    "            if (!yys) yys = \"illegal-symbol\";",
+    "            printf(\"%sdebug: state %d, reading %d (%s)\\n\",",
+    "                    YYPREFIX, yystate, yychar, yys);",
+    "        }",
+    "#endif",
+    "#if YYTRACE",
+    "        YYTRACEADD(YYTR_READ, yystate, yychar, -1);",
+    "#endif",
+    "    }",
+    "#if YYPROFILE",
+    "    ++YYPROFTOKENS[yystate][yychar <= YYMAXTOKEN ? yychar : YYMAXTOKEN + 1];",
+    "#endif",
+    "#if YYINTERLEAVED",
+    "    if ((yyn = yystaterecs[yystate].sindex) &&",
+    "            yypairs[yyn += YYCLASS(yychar)].check == YYCLASS(yychar))",
+    "    {",
+    "        yyn = yypairs[yyn].value;",
+    "#else",
+    "    if ((yyn = yysindex[yystate]) && (yyn += YYCLASS(yychar)) >= 0 &&",
+    "            yyn <= YYTABLESIZE && yycheck[yyn] == YYCLASS(yychar))",
+    "    {",
+    "        yyn = yytable[yyn];",
+    "#endif",
+    "#if YYDEBUG",
+    "        if (yydebug)",
+    "            printf(\"%sdebug: state %d, shifting to state %d\\n\",",
+    "                    YYPREFIX, yystate, yyn);",
+    "#endif",
+    "        if (yyssp >= yyss + yystacksize - 1)",
+    "        {",
+    "            goto yyoverflow;",
+    "        }",
+    "        *++yyssp = yystate = yyn;",
+    "#if YYTYPEDSTACK",
+    "        memcpy(yyvsp, &yylval, yyvsize[yystate]);",
+    "        yyvsp += yyvsize[yystate];",
+    "#else",
+    "#if YYLEXINPLACE",
+    "        ++yyvsp;",
+    "#else",
+    "        *++yyvsp = yylval;",
+    "#endif",
+    "#endif",
+    "#if YYSTATS",
+    "        ++YYSTATSREC.shifts;",
+    "#endif",
+    "#if YYTRACE",
+    "        YYTRACEADD(YYTR_SHIFT, yystate, yychar, -1);",
+    "#endif",
+    "        yychar = (-1);",
+    "        if (yyerrflag > 0)  --yyerrflag;",
+    "        goto yyloop;",
+    "    }",
+    "#if YYINTERLEAVED",
+    "    if ((yyn = yystaterecs[yystate].rindex) &&",
+    "            yypairs[yyn += YYCLASS(yychar)].check == YYCLASS(yychar))",
+    "    {",
+    "        yyn = yypairs[yyn].value;",
+    "        goto yyreduce;",
+    "    }",
+    "#else",
+    "    if ((yyn = yyrindex[yystate]) && (yyn += YYCLASS(yychar)) >= 0 &&",
+    "            yyn <= YYTABLESIZE && yycheck[yyn] == YYCLASS(yychar))",
+    "    {",
+    "        yyn = yytable[yyn];",
+    "        goto yyreduce;",
+    "    }",
+    "#endif",
+    "#if YYINTERLEAVED",
+    "    if ((yyn = -yystaterecs[yystate].defred) > 0) goto yyreduce;",
+    "#else",
+    "    if ((yyn = -yydefred[yystate]) > 0) goto yyreduce;",
+    "#endif",
+    "    if (yyerrflag) goto yyinrecovery;",
+    "#ifdef lint",
+    "    goto yynewerror;",
+    "#endif",
+    "yynewerror:",
+    "#if YYREENTRANT",
+    "    if (yyh->yysnap)",
+    "    {",
+    "        yyn = YYSPECFAIL;",
+    "        goto yyreturn;",
+    "    }",
+    "    yyh->yyssp = yyssp;",
+    "#endif",
+    "#if YYTRACE",
+    "    YYTRACEADD(YYTR_ERROR, yystate, yychar, -1);",
+    "#endif",
+    "    YYERRORCALL(\"syntax error\");",
+    "#ifdef lint",
+    "    goto yyerrlab;",
+    "#endif",
+    "yyerrlab:",
+    "    ++yynerrs;",
+    "yyinrecovery:",
+    "    if (yyerrflag < 3)",
+    "    {",
+    "        yyerrflag = 3;",
+    "        for (;;)",
+    "        {",
+    "#if YYINTERLEAVED",
+    "            if ((yyn = yystaterecs[*yyssp].sindex) &&",
+    "                    yypairs[yyn += YYERRCLASS].check == YYERRCLASS)",
+    "            {",
+    "                yyn = yypairs[yyn].value;",
+    "#else",
+    "            if ((yyn = yysindex[*yyssp]) && (yyn += YYERRCLASS) >= 0 &&",
+    "                    yyn <= YYTABLESIZE && yycheck[yyn] == YYERRCLASS)",
+    "            {",
+    "                yyn = yytable[yyn];",
+    "#endif",
+    "#if YYDEBUG",
+    "                if (yydebug)",
+    "                    printf(\"%sdebug: state %d, error recovery shifting\\",
+    " to state %d\\n\", YYPREFIX, *yyssp, yyn);",
+    "#endif",
+    "#if YYSTATS",
+    "                ++YYSTATSREC.recoveries;",
+    "#endif",
+    "#if YYTRACE",
+    "                YYTRACEADD(YYTR_RECOVER, yyn, YYERRCODE, -1);",
+    "#endif",
+    "                if (yyssp >= yyss + yystacksize - 1)",
+    "                {",
+    "                    goto yyoverflow;",
+    "                }",
+    "                *++yyssp = yystate = yyn;",
+    "#if YYTYPEDSTACK",
+    "                memcpy(yyvsp, &yylval, yyvsize[yystate]);",
+    "                yyvsp += yyvsize[yystate];",
+    "#else",
+    "#if YYLEXINPLACE",
+    "                if (yychar >= 0) yyvsp[2] = yyvsp[1];",
+    "                ++yyvsp;",
+    "#else",
+    "                *++yyvsp = yylval;",
+    "#endif",
+    "#endif",
+    "                goto yyloop;",
+    "            }",
+    "            else",
+    "            {",
+    "                yym = yyerrdepth[*yyssp];",
+    "#if YYTYPEDSTACK",
+    "                for (yyn = 0; yyn < yym; ++yyn)",
+    "                {",
+    "#if YYDEBUG",
+    "                    if (yydebug)",
+    "                        printf(\"%sdebug: error recovery discarding state\\",
+    " %d\\n\", YYPREFIX, yyssp[-yyn]);",
+    "#endif",
+    "#if YYTRACE",
+    "                    YYTRACEADD(YYTR_POP, yyssp[-yyn], -1, -1);",
+    "#endif",
+    "                    if (yyssp - yyn <= yyss) goto yyabort;",
+    "                    yyvsp -= yyvsize[yyssp[-yyn]];",
+    "                }",
+    "#else",
+    "#if YYDEBUG || YYTRACE",
+    "                for (yyn = 0; yyn < yym; ++yyn)",
+    "                {",
+    "#if YYDEBUG",
+    "                    if (yydebug)",
+    "                        printf(\"%sdebug: error recovery discarding state\\",
+    " %d\\n\", YYPREFIX, yyssp[-yyn]);",
+    "#endif",
+    "#if YYTRACE",
+    "                    YYTRACEADD(YYTR_POP, yyssp[-yyn], -1, -1);",
+    "#endif",
+    "                    if (yyssp - yyn <= yyss) goto yyabort;",
+    "                }",
+    "#endif",
+    "#endif",
+    "                if (yym > yyssp - yyss) goto yyabort;",
+    "                yyssp -= yym;",
+    "#if !YYTYPEDSTACK",
+    "                yyvsp -= yym;",
+    "#endif",
+    "#if YYSNAPSHOTS",
+    "                if (yyssp - yyss < yylow) yylow = yysave(yyh, yyssp - yyss);",
+    "#endif",
+    "#if YYLEXINPLACE",
+    "                if (yychar >= 0) yyvsp[1] = yyvsp[yym + 1];",
+    "#endif",
+    "            }",
+    "        }",
+    "    }",
+    "    else",
+    "    {",
+    "        if (yychar == 0) goto yyabort;",
+    "#if YYDEBUG",
+    "        if (yydebug)",
+    "        {",
+    "            yys = 0;",
+    "            if (yychar <= YYMAXTOKEN) yys = YYNAME(yychar);",
+    "            if (!yys) yys = \"illegal-symbol\";",
+    "            printf(\"%sdebug: state %d, error recovery discards token %d\
+ (%s)\\n\",",
+    "                    YYPREFIX, yystate, yychar, yys);",
+    "        }",
+    "#endif",
+    "#if YYTRACE",
+    "        YYTRACEADD(YYTR_DISCARD, yystate, yychar, -1);",
+    "#endif",
+    "        yychar = (-1);",
+    "        goto yyloop;",
+    "    }",
+    "yyreduce:",
+    "#if YYSTATS",
+    "    ++YYSTATSREC.reductions[yyn];",
+    "#endif",
+    "#if YYTRACE",
+    "    YYTRACEADD(YYTR_REDUCE, yystate, -1, yyn);",
+    "#endif",
+    "#if YYDEBUG",
+    "    if (yydebug)",
+    "        printf(\"%sdebug: state %d, reducing by rule %d (%s)\\n\",",
+    "                YYPREFIX, yystate, yyn, YYRULE(yyn));",
+    "#endif",
+    "    yym = yylen[yyn];",
+    "#if YYTYPEDSTACK",
+    "    if (yyvfirst[yyn])",
+    "        memcpy(&yyval, yyvsp - yyvlen[yyn], yyvfirst[yyn]);",
+    "#endif",
+    0
+};
 
-char *banner[] =
+
+char *switch_start[] =
 {
-    "#ifndef lint",
-    "static char yysccsid[] = \"@(#)yaccpar     1.9 (Berkeley) 02/21/93\";",
+    "    switch (yyn)",
+    "    {",
+    0
+};
+
+
+char *switch_end[] =
+{
+    "    default:",
+    "#if !YYTYPEDSTACK",
+    "        yyval = yyvsp[1-yym];",
     "#endif",
-    "#define YYBYACC 1",
-    "#define YYMAJOR 1",
-    "#define YYMINOR 9",
-    "#define yyclearin (yychar=(-1))",
-    "#define yyerrok (yyerrflag=0)",
-    "#define YYRECOVERING (yyerrflag!=0)",
+    "        break;",
+    "    }",
     0
 };
 
 
-char *tables[] =
+char *call_action[] =
 {
-    "extern short yylhs[];",
-    "extern short yylen[];",
-    "extern short yydefred[];",
-    "extern short yydgoto[];",
-    "extern short yysindex[];",
-    "extern short yyrindex[];",
-    "extern short yygindex[];",
-    "extern short yytable[];",
-    "extern short yycheck[];",
+    "    switch ((*yyactions[yyn])(yyvsp))",
+    "    {",
+    "    case 1:",
+    "        goto yyabort;",
+    "    case 2:",
+    "        goto yyaccept;",
+    "    case 3:",
+    "        goto yyerrlab;",
+    "    }",
+    0
+};
+
+
+char *trailer[] =
+{
+    "    yyssp -= yym;",
+    "    yystate = *yyssp;",
+    "#if YYTYPEDSTACK",
+    "    yyvsp -= yyvlen[yyn];",
+    "#else",
+    "    yyvsp -= yym;",
+    "#endif",
+    "#if YYSNAPSHOTS",
+    "    if (yyssp - yyss < yylow) yylow = yysave(yyh, yyssp - yyss);",
+    "#endif",
+    "#if YYLEXINPLACE",
+    "    if (yychar >= 0 && yym != 1) yyvsp[2] = yyvsp[yym + 1];",
+    "#endif",
+    "    yym = yylhs[yyn];",
+    "    if (yystate == 0 && yym == 0)",
+    "    {",
     "#if YYDEBUG",
-    "extern char *yyname[];",
-    "extern char *yyrule[];",
+    "        if (yydebug)",
+    "            printf(\"%sdebug: after reduction, shifting from state 0 to\\",
+    " state %d\\n\", YYPREFIX, YYFINAL);",
+    "#endif",
+    "#if YYTRACE",
+    "        YYTRACEADD(YYTR_GOTO, YYFINAL, -1, -1);",
+    "#endif",
+    "        yystate = YYFINAL;",
+    "        *++yyssp = YYFINAL;",
+    "#if YYTYPEDSTACK",
+    "        memcpy(yyvsp, &yyval, yyvsize[YYFINAL]);",
+    "        yyvsp += yyvsize[YYFINAL];",
+    "#else",
+    "        *++yyvsp = yyval;",
+    "#endif",
+    "#if YYREENTRANT",
+    "yyfinal:",
+    "#endif",
+    "        if (yychar < 0)",
+    "        {",
+    "            if ((yychar = YYLEX) < 0)",
+    "            {",
+    "#if YYREENTRANT",
+    "                if (yychar == YYSUSPEND)",
+    "                {",
+    "                    yychar = (-1);",
+    "                    yyn = YYSUSPENDED;",
+    "                    goto yyreturn;",
+    "                }",
+    "#endif",
+    "                yychar = 0;",
+    "            }",
+    "#if YYINTERLEAVED",
+    "            if (yychar > YYMAXTOKEN) yychar = YYMAXTOKEN + 1;",
+    "#endif",
+    "#if YYDEBUG",
+    "            if (yydebug)",
+    "            {",
+    "                yys = 0;",
+    "                if (yychar <= YYMAXTOKEN) yys = YYNAME(yychar);",
+    "                if (!yys) yys = \"illegal-symbol\";",
+    "                printf(\"%sdebug: state %d, reading %d (%s)\\n\",",
+    "                        YYPREFIX, YYFINAL, yychar, yys);",
+    "            }",
+    "#endif",
+    "#if YYTRACE",
+    "            YYTRACEADD(YYTR_READ, YYFINAL, yychar, -1);",
+    "#endif",
+    "        }",
+    "        if (yychar == 0) goto yyaccept;",
+    "        goto yyloop;",
+    "    }",
+    "#if YYINTERLEAVED",
+    "    if ((yyn = yygindex[yym]) && yypairs[yyn += yystate].check == yystate)",
+    "        yystate = yypairs[yyn].value;",
+    "#else",
+    "    if ((yyn = yygindex[yym]) && (yyn += yystate) >= 0 &&",
+    "            yyn <= YYTABLESIZE && yycheck[yyn] == yystate)",
+    "        yystate = yytable[yyn];",
+    "#endif",
+    "    else",
+    "        yystate = yydgoto[yym];",
+    "#if YYDEBUG",
+    "    if (yydebug)",
+    "        printf(\"%sdebug: after reduction, shifting from state %d \\",
+    "to state %d\\n\", YYPREFIX, *yyssp, yystate);",
+    "#endif",
+    "#if YYTRACE",
+    "    YYTRACEADD(YYTR_GOTO, yystate, -1, -1);",
+    "#endif",
+    "    if (yyssp >= yyss + yystacksize - 1)",
+    "    {",
+    "        goto yyoverflow;",
+    "    }",
+    "    *++yyssp = yystate;",
+    "#if YYTYPEDSTACK",
+    "    memcpy(yyvsp, &yyval, yyvsize[yystate]);",
+    "    yyvsp += yyvsize[yystate];",
+    "#else",
+    "    *++yyvsp = yyval;",
+    "#endif",
+    "    goto yyloop;",
+    "yyoverflow:",
+    "    YYERRORCALL(\"yacc stack overflow\");",
+    "yyabort:",
+    "#if YYTRACE",
+    "    YYTRACEADD(YYTR_ABORT, *yyssp, yychar, -1);",
+    "#endif",
+    "    yyn = 1;",
+    "    goto yyreturn;",
+    "yyaccept:",
+    "#if YYTRACE",
+    "    YYTRACEADD(YYTR_ACCEPT, YYFINAL, 0, -1);",
     "#endif",
+    "    yyn = 0;",
+    "#if YYBUDGET",
+    "    goto yyreturn;",
+    "yyexhausted:",
+    "    yyn = YYEXHAUSTED;",
+    "#endif",
+    "yyreturn:",
+    "#if YYBUDGET",
+    "    if (YYSTEPS > 0 && (YYSTEPS -= yygrant - yyleft) <= 0) YYSTEPS = -1;",
+    "#endif",
+    "#if YYSTATS",
+    "    ++YYSTATSREC.parses;",
+    "    if (yystatshook)",
+    "        (*yystatshook)(yyn, (long) YYSTATSCLOCK() - yystart);",
+    "#endif",
+    "#if YYREENTRANT",
+    "    yyh->yyssp = yyssp;",
+    "    yyh->yyvsp = yyvsp;",
+    "    yyh->yychar = yychar;",
+    "    if (yychar >= 0) yyh->yylval = yylval;",
+    "    yyh->yyerrflag = yyerrflag;",
+    "    yyh->yynerrs = yynerrs;",
+    "#endif",
+    "    return (yyn);",
+    "}",
     0
 };
 
 
-char *header[] =
+/*  The sections below replace header, body, switch_end and trailer     */
+/*  when a C++ parser is generated (-x c++).  The parser is a class     */
+/*  template, instantiated on the structure that holds the tables (see  */
+/*  begin_tables_struct in output.c) and on the type of the lexical     */
+/*  analyzer, which must provide the member functions                   */
+/*                                                                      */
+/*      int yylex(YYSTYPE &value);                                      */
+/*      void yyerror(const char *message);                              */
+/*                                                                      */
+/*  Semantic values are constructed on the value stack by moving them,  */
+/*  and destroyed when they are popped, so YYSTYPE may be any movable   */
+/*  type.                                                               */
+
+char *cxx_header[] =
 {
+    "#include <cstdio>",
+    "#include <cstdlib>",
+    "#include <new>",
+    "#include <utility>",
     "#ifdef YYSTACKSIZE",
     "#undef YYMAXDEPTH",
     "#define YYMAXDEPTH YYSTACKSIZE",
@@ -59,36 +1733,84 @@ char *header[] =
     "#define YYMAXDEPTH 500",
     "#endif",
     "#endif",
-    "int yydebug;",
-    "int yynerrs;",
-    "int yyerrflag;",
-    "int yychar;",
-    "short *yyssp;",
-    "YYSTYPE *yyvsp;",
-    "YYSTYPE yyval;",
-    "YYSTYPE yylval;",
-    "short yyss[YYSTACKSIZE];",
-    "YYSTYPE yyvs[YYSTACKSIZE];",
     "#define yystacksize YYSTACKSIZE",
+    "template <class Lexer, class Tables = yytables>",
+    "class yyparser : private Tables",
+    "{",
+    "public:",
+    "    explicit yyparser(Lexer &lexer)",
+    "        : yydebug(0), yynerrs(0), yylexer(lexer), yyerrflag(0), yychar(-1),",
+    "          yyssp(yyss), yyvsp(yyvalues()) {}",
+    "    ~yyparser() { yyclear(); }",
+    "    int yyparse();",
+    "    int yydebug;",
+    "    int yynerrs;",
+    "    yyparser(const yyparser &) = delete;",
+    "    yyparser &operator=(const yyparser &) = delete;",
+    "private:",
+    "    using Tables::yyerrcode;",
+    "    using Tables::yyfinal;",
+    "    using Tables::yymaxtoken;",
+    "    using Tables::yytablesize;",
+    "    using Tables::yylhs;",
+    "    using Tables::yylen;",
+    "    using Tables::yydefred;",
+    "    using Tables::yydgoto;",
+    "    using Tables::yysindex;",
+    "    using Tables::yyrindex;",
+    "    using Tables::yygindex;",
+    "    using Tables::yytable;",
+    "    using Tables::yycheck;",
+    "#if YYDEBUG",
+    "    using Tables::yyname;",
+    "    using Tables::yyrule;",
+    "#endif",
+    "    YYSTYPE *yyvalues()",
+    "    {",
+    "        return reinterpret_cast<YYSTYPE *>(yyvs);",
+    "    }",
+    "    void yypush(YYSTYPE &&value)",
+    "    {",
+    "        ::new (static_cast<void *>(++yyvsp)) YYSTYPE(std::move(value));",
+    "    }",
+    "    void yypop(int n)",
+    "    {",
+    "        while (--n >= 0)",
+    "            (yyvsp--)->~YYSTYPE();",
+    "    }",
+    "    void yyclear()",
+    "    {",
+    "        yypop(yyvsp - yyvalues());",
+    "    }",
+    "    void yyerror(const char *message)",
+    "    {",
+    "        yylexer.yyerror(message);",
+    "    }",
+    "    Lexer &yylexer;",
+    "    int yyerrflag;",
+    "    int yychar;",
+    "    short *yyssp;",
+    "    YYSTYPE *yyvsp;",
+    "    YYSTYPE yyval;",
+    "    YYSTYPE yylval;",
+    "    short yyss[YYSTACKSIZE];",
+    "    alignas(YYSTYPE) unsigned char yyvs[YYSTACKSIZE * sizeof(YYSTYPE)];",
+    "};",
     0
 };
 
 
-char *body[] =
+char *cxx_body[] =
 {
-    "#define YYABORT goto yyabort",
-    "#define YYREJECT goto yyabort",
-    "#define YYACCEPT goto yyaccept",
-    "#define YYERROR goto yyerrlab",
+    "template <class Lexer, class Tables>",
     "int",
-    "yyparse()",
+    "yyparser<Lexer, Tables>::yyparse()",
     "{",
-    "    register int yym, yyn, yystate;",
+    "    int yym, yyn, yystate;",
     "#if YYDEBUG",
-    "    register char *yys;",
-    "    extern char *getenv();",
+    "    const char *yys;",
     "",
-    "    if (yys = getenv(\"YYDEBUG\"))",
+    "    if ((yys = std::getenv(\"YYDEBUG\")))",
     "    {",
     "        yyn = *yys;",
     "        if (yyn >= '0' && yyn <= '9')",
@@ -100,32 +1822,32 @@ char *body[] =
     "    yyerrflag = 0;",
     "    yychar = (-1);",
     "",
+    "    yyclear();",
     "    yyssp = yyss;",
-    "    yyvsp = yyvs;",
     "    *yyssp = yystate = 0;",
     "",
     "yyloop:",
-    "    if (yyn = yydefred[yystate]) goto yyreduce;",
+    "    if ((yyn = yydefred[yystate]) > 0) goto yyreduce;",
     "    if (yychar < 0)",
     "    {",
-    "        if ((yychar = yylex()) < 0) yychar = 0;",
+    "        if ((yychar = yylexer.yylex(yylval)) < 0) yychar = 0;",
     "#if YYDEBUG",
     "        if (yydebug)",
     "        {",
     "            yys = 0;",
-    "            if (yychar <= YYMAXTOKEN) yys = yyname[yychar];",
+    "            if (yychar <= yymaxtoken) yys = yyname[yychar];",
     "            if (!yys) yys = \"illegal-symbol\";",
-    "            printf(\"%sdebug: state %d, reading %d (%s)\\n\",",
+    "            std::printf(\"%sdebug: state %d, reading %d (%s)\\n\",",
     "                    YYPREFIX, yystate, yychar, yys);",
     "        }",
     "#endif",
     "    }",
     "    if ((yyn = yysindex[yystate]) && (yyn += yychar) >= 0 &&",
-    "            yyn <= YYTABLESIZE && yycheck[yyn] == yychar)",
+    "            yyn <= yytablesize && yycheck[yyn] == yychar)",
     "    {",
     "#if YYDEBUG",
     "        if (yydebug)",
-    "            printf(\"%sdebug: state %d, shifting to state %d\\n\",",
+    "            std::printf(\"%sdebug: state %d, shifting to state %d\\n\",",
     "                    YYPREFIX, yystate, yytable[yyn]);",
     "#endif",
     "        if (yyssp >= yyss + yystacksize - 1)",
@@ -133,26 +1855,21 @@ char *body[] =
     "            goto yyoverflow;",
     "        }",
     "        *++yyssp = yystate = yytable[yyn];",
-    "        *++yyvsp = yylval;",
+    "        yypush(std::move(yylval));",
     "        yychar = (-1);",
     "        if (yyerrflag > 0)  --yyerrflag;",
     "        goto yyloop;",
     "    }",
     "    if ((yyn = yyrindex[yystate]) && (yyn += yychar) >= 0 &&",
-    "            yyn <= YYTABLESIZE && yycheck[yyn] == yychar)",
+    "            yyn <= yytablesize && yycheck[yyn] == yychar)",
     "    {",
     "        yyn = yytable[yyn];",
     "        goto yyreduce;",
     "    }",
+    "    if ((yyn = -yydefred[yystate]) > 0) goto yyreduce;",
     "    if (yyerrflag) goto yyinrecovery;",
-    "#ifdef lint",
-    "    goto yynewerror;",
-    "#endif",
-    "yynewerror:",
     "    yyerror(\"syntax error\");",
-    "#ifdef lint",
     "    goto yyerrlab;",
-    "#endif",
     "yyerrlab:",
     "    ++yynerrs;",
     "yyinrecovery:",
@@ -161,12 +1878,12 @@ char *body[] =
     "        yyerrflag = 3;",
     "        for (;;)",
     "        {",
-    "            if ((yyn = yysindex[*yyssp]) && (yyn += YYERRCODE) >= 0 &&",
-    "                    yyn <= YYTABLESIZE && yycheck[yyn] == YYERRCODE)",
+    "            if ((yyn = yysindex[*yyssp]) && (yyn += yyerrcode) >= 0 &&",
+    "                    yyn <= yytablesize && yycheck[yyn] == yyerrcode)",
     "            {",
     "#if YYDEBUG",
     "                if (yydebug)",
-    "                    printf(\"%sdebug: state %d, error recovery shifting\\",
+    "                    std::printf(\"%sdebug: state %d, error recovery shifting\\",
     " to state %d\\n\", YYPREFIX, *yyssp, yytable[yyn]);",
     "#endif",
     "                if (yyssp >= yyss + yystacksize - 1)",
@@ -174,20 +1891,20 @@ char *body[] =
     "                    goto yyoverflow;",
     "                }",
     "                *++yyssp = yystate = yytable[yyn];",
-    "                *++yyvsp = yylval;",
+    "                yypush(YYSTYPE());",
     "                goto yyloop;",
     "            }",
     "            else",
     "            {",
     "#if YYDEBUG",
     "                if (yydebug)",
-    "                    printf(\"%sdebug: error recovery discarding state %d\
+    "                    std::printf(\"%sdebug: error recovery discarding state %d\
 \\n\",",
     "                            YYPREFIX, *yyssp);",
     "#endif",
     "                if (yyssp <= yyss) goto yyabort;",
     "                --yyssp;",
-    "                --yyvsp;",
+    "                yypop(1);",
     "            }",
     "        }",
     "    }",
@@ -198,9 +1915,9 @@ char *body[] =
     "        if (yydebug)",
     "        {",
     "            yys = 0;",
-    "            if (yychar <= YYMAXTOKEN) yys = yyname[yychar];",
+    "            if (yychar <= yymaxtoken) yys = yyname[yychar];",
     "            if (!yys) yys = \"illegal-symbol\";",
-    "            printf(\"%sdebug: state %d, error recovery discards token %d\
+    "            std::printf(\"%sdebug: state %d, error recovery discards token %d\
  (%s)\\n\",",
     "                    YYPREFIX, yystate, yychar, yys);",
     "        }",
@@ -211,45 +1928,51 @@ char *body[] =
     "yyreduce:",
     "#if YYDEBUG",
     "    if (yydebug)",
-    "        printf(\"%sdebug: state %d, reducing by rule %d (%s)\\n\",",
+    "        std::printf(\"%sdebug: state %d, reducing by rule %d (%s)\\n\",",
     "                YYPREFIX, yystate, yyn, yyrule[yyn]);",
     "#endif",
     "    yym = yylen[yyn];",
-    "    yyval = yyvsp[1-yym];",
-    "    switch (yyn)",
-    "    {",
     0
 };
 
 
-char *trailer[] =
+char *cxx_switch_end[] =
 {
+    "    default:",
+    "        yyval = std::move(yyvsp[1-yym]);",
+    "        break;",
     "    }",
+    0
+};
+
+
+char *cxx_trailer[] =
+{
     "    yyssp -= yym;",
     "    yystate = *yyssp;",
-    "    yyvsp -= yym;",
+    "    yypop(yym);",
     "    yym = yylhs[yyn];",
     "    if (yystate == 0 && yym == 0)",
     "    {",
     "#if YYDEBUG",
     "        if (yydebug)",
-    "            printf(\"%sdebug: after reduction, shifting from state 0 to\\",
-    " state %d\\n\", YYPREFIX, YYFINAL);",
+    "            std::printf(\"%sdebug: after reduction, shifting from state 0 to\\",
+    " state %d\\n\", YYPREFIX, yyfinal);",
     "#endif",
-    "        yystate = YYFINAL;",
-    "        *++yyssp = YYFINAL;",
-    "        *++yyvsp = yyval;",
+    "        yystate = yyfinal;",
+    "        *++yyssp = yyfinal;",
+    "        yypush(std::move(yyval));",
     "        if (yychar < 0)",
     "        {",
-    "            if ((yychar = yylex()) < 0) yychar = 0;",
+    "            if ((yychar = yylexer.yylex(yylval)) < 0) yychar = 0;",
     "#if YYDEBUG",
     "            if (yydebug)",
     "            {",
     "                yys = 0;",
-    "                if (yychar <= YYMAXTOKEN) yys = yyname[yychar];",
+    "                if (yychar <= yymaxtoken) yys = yyname[yychar];",
     "                if (!yys) yys = \"illegal-symbol\";",
-    "                printf(\"%sdebug: state %d, reading %d (%s)\\n\",",
-    "                        YYPREFIX, YYFINAL, yychar, yys);",
+    "                std::printf(\"%sdebug: state %d, reading %d (%s)\\n\",",
+    "                        YYPREFIX, yyfinal, yychar, yys);",
     "            }",
     "#endif",
     "        }",
@@ -257,13 +1980,13 @@ char *trailer[] =
     "        goto yyloop;",
     "    }",
     "    if ((yyn = yygindex[yym]) && (yyn += yystate) >= 0 &&",
-    "            yyn <= YYTABLESIZE && yycheck[yyn] == yystate)",
+    "            yyn <= yytablesize && yycheck[yyn] == yystate)",
     "        yystate = yytable[yyn];",
     "    else",
     "        yystate = yydgoto[yym];",
     "#if YYDEBUG",
     "    if (yydebug)",
-    "        printf(\"%sdebug: after reduction, shifting from state %d \\",
+    "        std::printf(\"%sdebug: after reduction, shifting from state %d \\",
     "to state %d\\n\", YYPREFIX, *yyssp, yystate);",
     "#endif",
     "    if (yyssp >= yyss + yystacksize - 1)",
@@ -271,19 +1994,41 @@ char *trailer[] =
     "        goto yyoverflow;",
     "    }",
     "    *++yyssp = yystate;",
-    "    *++yyvsp = yyval;",
+    "    yypush(std::move(yyval));",
     "    goto yyloop;",
     "yyoverflow:",
     "    yyerror(\"yacc stack overflow\");",
     "yyabort:",
+    "    yyclear();",
     "    return (1);",
     "yyaccept:",
+    "    yyclear();",
     "    return (0);",
     "}",
     0
 };
 
 
+/*  The conditionals on the options of yacc itself, #if NAME or #if     */
+/*  !NAME where skeleton_flag knows NAME, are resolved as the sections  */
+/*  are written, so that a parser holds only the code of the options    */
+/*  it was generated with.  Other conditionals are copied, and the two  */
+/*  kinds may be nested in each other.                                  */
+
+#define MAXNEST 16
+
+static int
+skeleton_flag(name)
+char *name;
+{
+    if (strcmp(name, "YYREENTRANT") == 0) return (reflag);
+    if (strcmp(name, "YYLEXINPLACE") == 0) return (ipflag);
+    if (strcmp(name, "YYTYPEDSTACK") == 0) return (tsflag);
+    if (strcmp(name, "YYSNAPSHOTS") == 0) return (reflag && !tsflag);
+    return (-1);
+}
+
+
 write_section(section)
 char *section[];
 {
@@ -291,10 +2036,53 @@ char *section[];
     register int i;
     register char *s;
     register FILE *f;
+    int depth, dead, flag;
+    char nest[MAXNEST];
 
     f = code_file;
+    depth = 0;
+    dead = 0;
     for (i = 0; s = section[i]; ++i)
     {
+        if (strncmp(s, "#if", 3) == 0)
+        {
+            assert(depth < MAXNEST);
+            flag = -1;
+            if (s[3] == ' ')
+                flag = s[4] == '!' ? skeleton_flag(s + 5) : skeleton_flag(s + 4);
+            if (flag >= 0)
+            {
+                if (s[4] == '!') flag = !flag;
+                nest[depth++] = flag ? 'T' : 'F';
+                if (!flag) ++dead;
+                continue;
+            }
+            nest[depth++] = 'C';
+        }
+        else if (strcmp(s, "#else") == 0 && nest[depth - 1] != 'C')
+        {
+            if (nest[depth - 1] == 'T')
+            {
+                nest[depth - 1] = 'F';
+                ++dead;
+            }
+            else
+            {
+                nest[depth - 1] = 'T';
+                --dead;
+            }
+            continue;
+        }
+        else if (strcmp(s, "#endif") == 0)
+        {
+            if (nest[--depth] != 'C')
+            {
+                if (nest[depth] == 'F') --dead;
+                continue;
+            }
+        }
+        if (dead) continue;
+
         ++outline;
         while (c = *s)
         {
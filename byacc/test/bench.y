@@ -0,0 +1,307 @@
+/*
+ * Benchmark of the fixed cost of a parse.
+ *
+ * Parses single FTP commands, as a server does for each line it reads,
+ * with a subset of the grammar of ftp.y.  Every command is a complete
+ * input, so the time per parse is dominated by what yyparse does on
+ * entry and exit rather than by the tokens.  The time taken to scan the
+ * same commands without parsing them is printed for comparison.
+ *
+ * Build it with "make bench", which generates the parser twice: with
+ * yyparse() and its globals, and with --reentrant, where one handle
+ * initialized by yyparse_init is reused through yyparse_reset.
+ * Both are generated with -t, as production parsers often are.
+ */
+
+%{
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <time.h>
+
+struct input
+{
+	char	*p;
+	int	first;
+};
+
+long	checksum;
+%}
+
+%union {
+	int	num;
+	char	*str;
+}
+
+%token
+	SP	CRLF	COMMA	STRING	NUMBER
+
+	USER	PASS	QUIT	PORT	TYPE	RETR
+	STOR	CWD	LIST	NOOP	SIZE	PWD
+
+	LEXERR
+
+%type	<num>	NUMBER host_port
+%type	<str>	STRING
+
+%start	cmd
+
+%%
+
+cmd:		USER SP STRING CRLF
+		= {
+			checksum += $3[0];
+		}
+	|	PASS SP STRING CRLF
+		= {
+			checksum += $3[0];
+		}
+	|	PORT SP host_port CRLF
+		= {
+			checksum += $3;
+		}
+	|	TYPE SP STRING CRLF
+		= {
+			checksum += $3[0];
+		}
+	|	RETR SP STRING CRLF
+		= {
+			checksum += $3[0];
+		}
+	|	STOR SP STRING CRLF
+		= {
+			checksum += $3[0];
+		}
+	|	CWD SP STRING CRLF
+		= {
+			checksum += $3[0];
+		}
+	|	LIST CRLF
+		= {
+			checksum += 1;
+		}
+	|	LIST SP STRING CRLF
+		= {
+			checksum += $3[0];
+		}
+	|	SIZE SP STRING CRLF
+		= {
+			checksum += $3[0];
+		}
+	|	PWD CRLF
+		= {
+			checksum += 2;
+		}
+	|	NOOP CRLF
+		= {
+			checksum += 3;
+		}
+	|	QUIT CRLF
+		= {
+			checksum += 4;
+		}
+	;
+
+host_port:	NUMBER COMMA NUMBER COMMA NUMBER COMMA
+		NUMBER COMMA NUMBER COMMA NUMBER
+		= {
+			$$ = $1 + $3 + $5 + $7 + ($9 << 8) + $11;
+		}
+	;
+
+%%
+
+struct tab {
+	char	*name;
+	short	token;
+};
+
+struct tab cmdtab[] = {
+	{ "USER", USER },
+	{ "PASS", PASS },
+	{ "QUIT", QUIT },
+	{ "PORT", PORT },
+	{ "TYPE", TYPE },
+	{ "RETR", RETR },
+	{ "STOR", STOR },
+	{ "CWD", CWD },
+	{ "LIST", LIST },
+	{ "NOOP", NOOP },
+	{ "SIZE", SIZE },
+	{ "PWD", PWD },
+	{ 0, 0 }
+};
+
+char *commands[] = {
+	"USER anonymous\r\n",
+	"PASS guest@example.org\r\n",
+	"CWD /pub/bsd\r\n",
+	"TYPE I\r\n",
+	"PORT 127,0,0,1,4,15\r\n",
+	"SIZE README\r\n",
+	"RETR README\r\n",
+	"LIST\r\n",
+	"PWD\r\n",
+	"NOOP\r\n",
+	"QUIT\r\n",
+	0
+};
+
+/*
+ * The scanner keeps its position in an input structure, so that the
+ * reentrant parser can be given one per handle.
+ */
+int
+scan(in, lvalp)
+	register struct input *in;
+	YYSTYPE *lvalp;
+{
+	register char *cp;
+	register struct tab *p;
+	register int n, len;
+
+	cp = in->p;
+	switch (*cp) {
+
+	case '\0':
+		return (0);
+
+	case ' ':
+		in->p = cp + 1;
+		return (SP);
+
+	case ',':
+		in->p = cp + 1;
+		return (COMMA);
+
+	case '\r':
+		if (cp[1] == '\n')
+			cp++;
+		/* FALLTHROUGH */
+	case '\n':
+		in->p = cp + 1;
+		return (CRLF);
+	}
+	if (isdigit(*cp)) {
+		for (n = 0; isdigit(*cp); cp++)
+			n = n * 10 + *cp - '0';
+		in->p = cp;
+		lvalp->num = n;
+		return (NUMBER);
+	}
+	for (len = 0; cp[len] && cp[len] != ' ' && cp[len] != '\r' &&
+	    cp[len] != '\n'; len++)
+		;
+	in->p = cp + len;
+	if (in->first) {
+		in->first = 0;
+		for (p = cmdtab; p->name; p++)
+			if (strncmp(p->name, cp, len) == 0 &&
+			    p->name[len] == '\0')
+				return (p->token);
+		return (LEXERR);
+	}
+	lvalp->str = cp;
+	return (STRING);
+}
+
+#if YYREENTRANT
+yylex(lvalp, in)
+	YYSTYPE *lvalp;
+	void *in;
+{
+	return (scan((struct input *) in, lvalp));
+}
+
+yyerror(s, in)
+	char *s;
+	void *in;
+{
+	fprintf(stderr, "bench: %s\n", s);
+}
+#else
+struct input input;
+
+yylex()
+{
+	return (scan(&input, &yylval));
+}
+
+yyerror(s)
+	char *s;
+{
+	fprintf(stderr, "bench: %s\n", s);
+}
+#endif
+
+double
+seconds(start)
+	clock_t start;
+{
+	return ((double) (clock() - start) / CLOCKS_PER_SEC);
+}
+
+main(argc, argv)
+	int argc;
+	char *argv[];
+{
+	register long i, n;
+	register char **cmd;
+	struct input scanner;
+	YYSTYPE lval;
+	clock_t start;
+	double lex, parse;
+	long errors;
+#if YYREENTRANT
+	static struct yyhandle handle;
+#endif
+
+	n = argc > 1 ? atol(argv[1]) : 2000000;
+
+	start = clock();
+	for (i = 0, cmd = commands; i < n; i++) {
+		scanner.p = *cmd;
+		scanner.first = 1;
+		while (scan(&scanner, &lval) > 0)
+			checksum++;
+		if (*++cmd == 0)
+			cmd = commands;
+	}
+	lex = seconds(start);
+
+	errors = 0;
+	start = clock();
+#if YYREENTRANT
+	yyparse_init(&handle, (void *) &scanner);
+	for (i = 0, cmd = commands; i < n; i++) {
+		scanner.p = *cmd;
+		scanner.first = 1;
+		yyparse_reset(&handle, (void *) &scanner);
+		if (yyparse(&handle))
+			errors++;
+		if (*++cmd == 0)
+			cmd = commands;
+	}
+#else
+	for (i = 0, cmd = commands; i < n; i++) {
+		input.p = *cmd;
+		input.first = 1;
+		if (yyparse())
+			errors++;
+		if (*++cmd == 0)
+			cmd = commands;
+	}
+#endif
+	parse = seconds(start);
+
+#if YYREENTRANT
+	printf("reentrant:");
+#else
+	printf("yyparse():");
+#endif
+	printf(" %ld parses, %ld errors, %.1f ns per parse", n, errors,
+	    parse * 1e9 / n);
+	printf(" (scanning alone %.1f ns)\n", lex * 1e9 / n);
+	exit(errors != 0);
+}
@@ -1,5 +1,5 @@
 #ifndef lint
-static char yysccsid[] = "@(#)yaccpar	1.9 (Berkeley) 02/21/93";
+static char yysccsid[] = "@(#)yaccpar     1.9 (Berkeley) 02/21/93";
 #endif
 #define YYBYACC 1
 #define YYMAJOR 1
@@ -20,6 +20,9 @@ short yydefred[] = {                                      0,
 };
 short yydgoto[] = {                                       2,
 };
+short yyerrdepth[] = {                                    0,
+    1,    1,
+};
 short yysindex[] = {                                   -256,
     0,    0,
 };
@@ -33,11 +36,25 @@ short yytable[] = {                                       1,
 };
 short yycheck[] = {                                     256,
 };
+#if YYEXPECTED
+#define YYEXPECTBYTES 1
+unsigned char yyexpect[][YYEXPECTBYTES] = {
+{0,},
+{1,},
+};
+short yyexprow[] = {
+    0,    1,    0,
+};
+#endif
 #define YYFINAL 2
+#define YYNSTATES 3
+#define YYNRULES 2
 #ifndef YYDEBUG
 #define YYDEBUG 0
 #endif
 #define YYMAXTOKEN 0
+#define YYNAME(i) yyname[i]
+#define YYRULE(i) yyrule[i]
 #if YYDEBUG
 char *yyname[] = {
 "end-of-file",
@@ -62,6 +79,75 @@ typedef int YYSTYPE;
 #endif
 #endif
 int yydebug;
+#if YYSTATS
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#ifndef YYSTATSCLOCK
+#define YYSTATSCLOCK() clock()
+#endif
+struct yystats
+{
+    long parses;
+    long shifts;
+    long recoveries;
+    long maxdepth;
+    long states;
+    long reductions[YYNRULES];
+};
+#endif
+#if YYPROFILE
+#include <stdio.h>
+#include <string.h>
+#endif
+#if YYTRACE
+#include <stdio.h>
+#ifndef YYTRACESIZE
+#define YYTRACESIZE 1024
+#endif
+#define YYTR_READ 1
+#define YYTR_SHIFT 2
+#define YYTR_REDUCE 3
+#define YYTR_GOTO 4
+#define YYTR_ERROR 5
+#define YYTR_RECOVER 6
+#define YYTR_POP 7
+#define YYTR_DISCARD 8
+#define YYTR_ACCEPT 9
+#define YYTR_ABORT 10
+struct yytrace
+{
+    unsigned char event;
+    short state;
+    short token;
+    short rule;
+};
+#endif
+#define yystacksize YYSTACKSIZE
+#if YYTOKENCLASSES
+#define YYCLASS(c) ((c) <= YYMAXTOKEN ? yytranslate[c] : 0)
+#else
+#define YYCLASS(c) (c)
+#define YYERRCLASS YYERRCODE
+#endif
+#if YYBUDGET
+#define YYEXHAUSTED 5
+#ifndef YYBUDGETINTERVAL
+#define YYBUDGETINTERVAL 1024
+#endif
+#ifndef YYCLOCK
+#include <time.h>
+static long
+yyclock()
+{
+    struct timespec yyt;
+
+    clock_gettime(CLOCK_MONOTONIC, &yyt);
+    return (yyt.tv_sec * 1000000000L + yyt.tv_nsec);
+}
+#define YYCLOCK() yyclock()
+#endif
+#endif
 int yynerrs;
 int yyerrflag;
 int yychar;
@@ -71,12 +157,211 @@ YYSTYPE yyval;
 YYSTYPE yylval;
 short yyss[YYSTACKSIZE];
 YYSTYPE yyvs[YYSTACKSIZE];
-#define yystacksize YYSTACKSIZE
+#define YYLEX yylex()
+#define YYERRORCALL(msg) yyerror(msg)
+#if YYBUDGET
+long yysteps;
+long yydeadline;
+#endif
+#if YYSTATS
+struct yystats yystats;
+#endif
+#define YYSTATSREC yystats
+#if YYTRACE
+struct yytrace yytracebuf[YYTRACESIZE];
+unsigned long yytracepos;
+#endif
+#define YYTRACEBUF yytracebuf
+#define YYTRACEPOS yytracepos
+#define YYTRACEADD(e, s, t, r) yytraceadd(e, s, t, r)
+#if YYPROFILE
+long yyprofstates[YYNSTATES];
+long yyproftokens[YYNSTATES][YYMAXTOKEN + 2];
+#endif
+#define YYPROFSTATES yyprofstates
+#define YYPROFTOKENS yyproftokens
+#if YYINCREMENTAL
+#error "YYINCREMENTAL requires --reentrant"
+#endif
+#if YYBUDGET
+#define YYSTEPS yysteps
+#define YYDEADLINE yydeadline
+#endif
+#if YYEXPECTED
+#define YYEXPECTS(state, token) \
+        (yyexpect[yyexprow[state]][(token) >> 3] >> ((token) & 7) & 1)
+int
+yyexpected(state, tokens, max)
+int state;
+int *tokens;
+int max;
+{
+    register unsigned char *yyb;
+    register int yyi, yyn;
+
+    yyb = yyexpect[yyexprow[state]];
+    yyn = 0;
+    for (yyi = 0; yyi < YYEXPECTBYTES * 8; ++yyi)
+    {
+        if (yyb[yyi >> 3] == 0)
+            yyi |= 7;
+        else if (yyb[yyi >> 3] >> (yyi & 7) & 1)
+        {
+            if (yyn < max) tokens[yyn] = yyi;
+            ++yyn;
+        }
+    }
+    return (yyn);
+}
+#endif
+#if YYPROFILE
+#ifndef YYCANONICAL
+#define YYCANONICAL(s) (s)
+#endif
+int
+yyprofdump(fp)
+FILE *fp;
+{
+    register int i, j;
+
+    fprintf(fp, "states %d\n", YYNSTATES);
+    for (i = 0; i < YYNSTATES; ++i)
+    {
+        if (YYPROFSTATES[i])
+            fprintf(fp, "s %d %ld\n", YYCANONICAL(i), YYPROFSTATES[i]);
+        for (j = 0; j <= YYMAXTOKEN + 1; ++j)
+            if (YYPROFTOKENS[i][j])
+                fprintf(fp, "t %d %d %ld\n", YYCANONICAL(i), j,
+                        YYPROFTOKENS[i][j]);
+    }
+    return (ferror(fp) ? -1 : 0);
+}
+#endif
+#if YYSTATS
+void (*yystatshook)();
+int
+yystatsdump(fp)
+FILE *fp;
+{
+    register int i;
+
+    fprintf(fp, "parses %ld\nshifts %ld\nrecoveries %ld\n",
+            YYSTATSREC.parses, YYSTATSREC.shifts, YYSTATSREC.recoveries);
+    fprintf(fp, "maxdepth %ld\nstates %ld\n",
+            YYSTATSREC.maxdepth, YYSTATSREC.states);
+    for (i = 0; i < YYNRULES; ++i)
+        if (YYSTATSREC.reductions[i])
+#if YYDEBUG
+            fprintf(fp, "rule %d %ld %s\n", i, YYSTATSREC.reductions[i],
+                    YYRULE(i));
+#else
+            fprintf(fp, "rule %d %ld\n", i, YYSTATSREC.reductions[i]);
+#endif
+    return (ferror(fp) ? -1 : 0);
+}
+#endif
+#if YYTRACE
+static void
+yytraceadd(event, state, token, rule)
+int event, state, token, rule;
+{
+    register struct yytrace *yyt;
+
+    yyt = &YYTRACEBUF[YYTRACEPOS++ % YYTRACESIZE];
+    yyt->event = event;
+    yyt->state = state;
+    yyt->token = token <= YYMAXTOKEN ? token : YYMAXTOKEN + 1;
+    yyt->rule = rule;
+}
+int
+yytracedump(fp)
+FILE *fp;
+{
+    register unsigned long i;
+    register struct yytrace *yyt;
+
+    i = YYTRACEPOS > YYTRACESIZE ? YYTRACEPOS - YYTRACESIZE : 0;
+    for (; i < YYTRACEPOS; ++i)
+    {
+        yyt = &YYTRACEBUF[i % YYTRACESIZE];
+        putc(yyt->event, fp);
+        putc(0, fp);
+        putc(yyt->state & 0xff, fp);
+        putc((yyt->state >> 8) & 0xff, fp);
+        putc(yyt->token & 0xff, fp);
+        putc((yyt->token >> 8) & 0xff, fp);
+        putc(yyt->rule & 0xff, fp);
+        putc((yyt->rule >> 8) & 0xff, fp);
+    }
+    return (ferror(fp) ? -1 : 0);
+}
+#if YYDEBUG
+int
+yytracedecode(in, out)
+FILE *in, *out;
+{
+    unsigned char r[8];
+    register int state, token, rule;
+    register char *s;
+
+    while (fread((char *) r, 1, 8, in) == 8)
+    {
+        state = (short) (r[2] | r[3] << 8);
+        token = (short) (r[4] | r[5] << 8);
+        rule = (short) (r[6] | r[7] << 8);
+        s = 0;
+        if (token >= 0 && token <= YYMAXTOKEN) s = YYNAME(token);
+        if (!s) s = "illegal-symbol";
+        switch (r[0])
+        {
+        case YYTR_READ:
+            fprintf(out, "state %d, reading %d (%s)\n", state, token, s);
+            break;
+        case YYTR_SHIFT:
+            fprintf(out, "shifting %d (%s) to state %d\n", token, s,
+                    state);
+            break;
+        case YYTR_REDUCE:
+            fprintf(out, "state %d, reducing by rule %d (%s)\n", state,
+                    rule, rule >= 0 && rule < YYNRULES ? YYRULE(rule) : "?");
+            break;
+        case YYTR_GOTO:
+            fprintf(out, "after reduction, going to state %d\n", state);
+            break;
+        case YYTR_ERROR:
+            fprintf(out, "state %d, syntax error at %d (%s)\n", state,
+                    token, s);
+            break;
+        case YYTR_RECOVER:
+            fprintf(out, "error recovery shifting to state %d\n", state);
+            break;
+        case YYTR_POP:
+            fprintf(out, "error recovery discarding state %d\n", state);
+            break;
+        case YYTR_DISCARD:
+            fprintf(out, "state %d, error recovery discards token %d (%s)\n",
+                    state, token, s);
+            break;
+        case YYTR_ACCEPT:
+            fprintf(out, "accept\n");
+            break;
+        case YYTR_ABORT:
+            fprintf(out, "abort in state %d\n", state);
+            break;
+        default:
+            fprintf(out, "unknown event %d\n", r[0]);
+            break;
+        }
+    }
+    return (ferror(out) ? -1 : 0);
+}
+#endif
+#endif
 #line 4 "error.y"
 main(){printf("yyparse() = %d\n",yyparse());}
 yylex(){return-1;}
 yyerror(s)char*s;{printf("%s\n",s);}
-#line 80 "error.tab.c"
+#line 365 "error.tab.c"
 #define YYABORT goto yyabort
 #define YYREJECT goto yyabort
 #define YYACCEPT goto yyaccept
@@ -85,6 +370,12 @@ int
 yyparse()
 {
     register int yym, yyn, yystate;
+#if YYSTATS
+    long yystart;
+#endif
+#if YYBUDGET
+    long yyleft, yygrant;
+#endif
 #if YYDEBUG
     register char *yys;
     extern char *getenv();
@@ -96,6 +387,11 @@ yyparse()
             yydebug = yyn - '0';
     }
 #endif
+#if YYBUDGET
+    yygrant = YYDEADLINE ? YYBUDGETINTERVAL : 0x7fffffffL;
+    if (YYSTEPS && YYSTEPS < yygrant) yygrant = YYSTEPS < 0 ? 0 : YYSTEPS;
+    yyleft = yygrant;
+#endif
 
     yynerrs = 0;
     yyerrflag = 0;
@@ -104,53 +400,123 @@ yyparse()
     yyssp = yyss;
     yyvsp = yyvs;
     *yyssp = yystate = 0;
+#if YYSTATS
+    yystart = yystatshook ? (long) YYSTATSCLOCK() : 0;
+#endif
 
 yyloop:
-    if (yyn = yydefred[yystate]) goto yyreduce;
+#if YYBUDGET
+    if (--yyleft < 0)
+    {
+        if (YYSTEPS > 0 && (YYSTEPS -= yygrant) <= 0) YYSTEPS = -1;
+        yygrant = yyleft = 0;
+        if (YYSTEPS < 0 || YYDEADLINE && YYCLOCK() >= YYDEADLINE)
+            goto yyexhausted;
+        yygrant = YYDEADLINE ? YYBUDGETINTERVAL : 0x7fffffffL;
+        if (YYSTEPS > 0 && YYSTEPS < yygrant) yygrant = YYSTEPS;
+        yyleft = yygrant - 1;
+    }
+#endif
+#if YYPROFILE
+    ++YYPROFSTATES[yystate];
+#endif
+#if YYSTATS
+    ++YYSTATSREC.states;
+    if (yyssp - yyss >= YYSTATSREC.maxdepth)
+        YYSTATSREC.maxdepth = yyssp - yyss + 1;
+#endif
+#if YYINTERLEAVED
+    if ((yyn = yystaterecs[yystate].defred) > 0) goto yyreduce;
+#else
+    if ((yyn = yydefred[yystate]) > 0) goto yyreduce;
+#endif
     if (yychar < 0)
     {
-        if ((yychar = yylex()) < 0) yychar = 0;
+        if ((yychar = YYLEX) < 0)
+        {
+            yychar = 0;
+        }
+#if YYINTERLEAVED
+        if (yychar > YYMAXTOKEN) yychar = YYMAXTOKEN + 1;
+#endif
 #if YYDEBUG
         if (yydebug)
         {
             yys = 0;
-            if (yychar <= YYMAXTOKEN) yys = yyname[yychar];
+            if (yychar <= YYMAXTOKEN) yys = YYNAME(yychar);
             if (!yys) yys = "illegal-symbol";
             printf("%sdebug: state %d, reading %d (%s)\n",
                     YYPREFIX, yystate, yychar, yys);
         }
+#endif
+#if YYTRACE
+        YYTRACEADD(YYTR_READ, yystate, yychar, -1);
 #endif
     }
-    if ((yyn = yysindex[yystate]) && (yyn += yychar) >= 0 &&
-            yyn <= YYTABLESIZE && yycheck[yyn] == yychar)
+#if YYPROFILE
+    ++YYPROFTOKENS[yystate][yychar <= YYMAXTOKEN ? yychar : YYMAXTOKEN + 1];
+#endif
+#if YYINTERLEAVED
+    if ((yyn = yystaterecs[yystate].sindex) &&
+            yypairs[yyn += YYCLASS(yychar)].check == YYCLASS(yychar))
     {
+        yyn = yypairs[yyn].value;
+#else
+    if ((yyn = yysindex[yystate]) && (yyn += YYCLASS(yychar)) >= 0 &&
+            yyn <= YYTABLESIZE && yycheck[yyn] == YYCLASS(yychar))
+    {
+        yyn = yytable[yyn];
+#endif
 #if YYDEBUG
         if (yydebug)
             printf("%sdebug: state %d, shifting to state %d\n",
-                    YYPREFIX, yystate, yytable[yyn]);
+                    YYPREFIX, yystate, yyn);
 #endif
         if (yyssp >= yyss + yystacksize - 1)
         {
             goto yyoverflow;
         }
-        *++yyssp = yystate = yytable[yyn];
+        *++yyssp = yystate = yyn;
         *++yyvsp = yylval;
+#if YYSTATS
+        ++YYSTATSREC.shifts;
+#endif
+#if YYTRACE
+        YYTRACEADD(YYTR_SHIFT, yystate, yychar, -1);
+#endif
         yychar = (-1);
         if (yyerrflag > 0)  --yyerrflag;
         goto yyloop;
     }
-    if ((yyn = yyrindex[yystate]) && (yyn += yychar) >= 0 &&
-            yyn <= YYTABLESIZE && yycheck[yyn] == yychar)
+#if YYINTERLEAVED
+    if ((yyn = yystaterecs[yystate].rindex) &&
+            yypairs[yyn += YYCLASS(yychar)].check == YYCLASS(yychar))
+    {
+        yyn = yypairs[yyn].value;
+        goto yyreduce;
+    }
+#else
+    if ((yyn = yyrindex[yystate]) && (yyn += YYCLASS(yychar)) >= 0 &&
+            yyn <= YYTABLESIZE && yycheck[yyn] == YYCLASS(yychar))
     {
         yyn = yytable[yyn];
         goto yyreduce;
     }
+#endif
+#if YYINTERLEAVED
+    if ((yyn = -yystaterecs[yystate].defred) > 0) goto yyreduce;
+#else
+    if ((yyn = -yydefred[yystate]) > 0) goto yyreduce;
+#endif
     if (yyerrflag) goto yyinrecovery;
 #ifdef lint
     goto yynewerror;
 #endif
 yynewerror:
-    yyerror("syntax error");
+#if YYTRACE
+    YYTRACEADD(YYTR_ERROR, yystate, yychar, -1);
+#endif
+    YYERRORCALL("syntax error");
 #ifdef lint
     goto yyerrlab;
 #endif
@@ -162,32 +528,56 @@ yyinrecovery:
         yyerrflag = 3;
         for (;;)
         {
-            if ((yyn = yysindex[*yyssp]) && (yyn += YYERRCODE) >= 0 &&
-                    yyn <= YYTABLESIZE && yycheck[yyn] == YYERRCODE)
+#if YYINTERLEAVED
+            if ((yyn = yystaterecs[*yyssp].sindex) &&
+                    yypairs[yyn += YYERRCLASS].check == YYERRCLASS)
+            {
+                yyn = yypairs[yyn].value;
+#else
+            if ((yyn = yysindex[*yyssp]) && (yyn += YYERRCLASS) >= 0 &&
+                    yyn <= YYTABLESIZE && yycheck[yyn] == YYERRCLASS)
             {
+                yyn = yytable[yyn];
+#endif
 #if YYDEBUG
                 if (yydebug)
                     printf("%sdebug: state %d, error recovery shifting\
- to state %d\n", YYPREFIX, *yyssp, yytable[yyn]);
+ to state %d\n", YYPREFIX, *yyssp, yyn);
+#endif
+#if YYSTATS
+                ++YYSTATSREC.recoveries;
+#endif
+#if YYTRACE
+                YYTRACEADD(YYTR_RECOVER, yyn, YYERRCODE, -1);
 #endif
                 if (yyssp >= yyss + yystacksize - 1)
                 {
                     goto yyoverflow;
                 }
-                *++yyssp = yystate = yytable[yyn];
+                *++yyssp = yystate = yyn;
                 *++yyvsp = yylval;
                 goto yyloop;
             }
             else
             {
+                yym = yyerrdepth[*yyssp];
+#if YYDEBUG || YYTRACE
+                for (yyn = 0; yyn < yym; ++yyn)
+                {
 #if YYDEBUG
-                if (yydebug)
-                    printf("%sdebug: error recovery discarding state %d\n",
-                            YYPREFIX, *yyssp);
+                    if (yydebug)
+                        printf("%sdebug: error recovery discarding state\
+ %d\n", YYPREFIX, yyssp[-yyn]);
+#endif
+#if YYTRACE
+                    YYTRACEADD(YYTR_POP, yyssp[-yyn], -1, -1);
+#endif
+                    if (yyssp - yyn <= yyss) goto yyabort;
+                }
 #endif
-                if (yyssp <= yyss) goto yyabort;
-                --yyssp;
-                --yyvsp;
+                if (yym > yyssp - yyss) goto yyabort;
+                yyssp -= yym;
+                yyvsp -= yym;
             }
         }
     }
@@ -198,25 +588,36 @@ yyinrecovery:
         if (yydebug)
         {
             yys = 0;
-            if (yychar <= YYMAXTOKEN) yys = yyname[yychar];
+            if (yychar <= YYMAXTOKEN) yys = YYNAME(yychar);
             if (!yys) yys = "illegal-symbol";
             printf("%sdebug: state %d, error recovery discards token %d (%s)\n",
                     YYPREFIX, yystate, yychar, yys);
         }
+#endif
+#if YYTRACE
+        YYTRACEADD(YYTR_DISCARD, yystate, yychar, -1);
 #endif
         yychar = (-1);
         goto yyloop;
     }
 yyreduce:
+#if YYSTATS
+    ++YYSTATSREC.reductions[yyn];
+#endif
+#if YYTRACE
+    YYTRACEADD(YYTR_REDUCE, yystate, -1, yyn);
+#endif
 #if YYDEBUG
     if (yydebug)
         printf("%sdebug: state %d, reducing by rule %d (%s)\n",
-                YYPREFIX, yystate, yyn, yyrule[yyn]);
+                YYPREFIX, yystate, yyn, YYRULE(yyn));
 #endif
     yym = yylen[yyn];
-    yyval = yyvsp[1-yym];
     switch (yyn)
     {
+    default:
+        yyval = yyvsp[1-yym];
+        break;
     }
     yyssp -= yym;
     yystate = *yyssp;
@@ -228,36 +629,56 @@ yyreduce:
         if (yydebug)
             printf("%sdebug: after reduction, shifting from state 0 to\
  state %d\n", YYPREFIX, YYFINAL);
+#endif
+#if YYTRACE
+        YYTRACEADD(YYTR_GOTO, YYFINAL, -1, -1);
 #endif
         yystate = YYFINAL;
         *++yyssp = YYFINAL;
         *++yyvsp = yyval;
         if (yychar < 0)
         {
-            if ((yychar = yylex()) < 0) yychar = 0;
+            if ((yychar = YYLEX) < 0)
+            {
+                yychar = 0;
+            }
+#if YYINTERLEAVED
+            if (yychar > YYMAXTOKEN) yychar = YYMAXTOKEN + 1;
+#endif
 #if YYDEBUG
             if (yydebug)
             {
                 yys = 0;
-                if (yychar <= YYMAXTOKEN) yys = yyname[yychar];
+                if (yychar <= YYMAXTOKEN) yys = YYNAME(yychar);
                 if (!yys) yys = "illegal-symbol";
                 printf("%sdebug: state %d, reading %d (%s)\n",
                         YYPREFIX, YYFINAL, yychar, yys);
             }
+#endif
+#if YYTRACE
+            YYTRACEADD(YYTR_READ, YYFINAL, yychar, -1);
 #endif
         }
         if (yychar == 0) goto yyaccept;
         goto yyloop;
     }
+#if YYINTERLEAVED
+    if ((yyn = yygindex[yym]) && yypairs[yyn += yystate].check == yystate)
+        yystate = yypairs[yyn].value;
+#else
     if ((yyn = yygindex[yym]) && (yyn += yystate) >= 0 &&
             yyn <= YYTABLESIZE && yycheck[yyn] == yystate)
         yystate = yytable[yyn];
+#endif
     else
         yystate = yydgoto[yym];
 #if YYDEBUG
     if (yydebug)
         printf("%sdebug: after reduction, shifting from state %d \
 to state %d\n", YYPREFIX, *yyssp, yystate);
+#endif
+#if YYTRACE
+    YYTRACEADD(YYTR_GOTO, yystate, -1, -1);
 #endif
     if (yyssp >= yyss + yystacksize - 1)
     {
@@ -267,9 +688,31 @@ to state %d\n", YYPREFIX, *yyssp, yystate);
     *++yyvsp = yyval;
     goto yyloop;
 yyoverflow:
-    yyerror("yacc stack overflow");
+    YYERRORCALL("yacc stack overflow");
 yyabort:
-    return (1);
+#if YYTRACE
+    YYTRACEADD(YYTR_ABORT, *yyssp, yychar, -1);
+#endif
+    yyn = 1;
+    goto yyreturn;
 yyaccept:
-    return (0);
+#if YYTRACE
+    YYTRACEADD(YYTR_ACCEPT, YYFINAL, 0, -1);
+#endif
+    yyn = 0;
+#if YYBUDGET
+    goto yyreturn;
+yyexhausted:
+    yyn = YYEXHAUSTED;
+#endif
+yyreturn:
+#if YYBUDGET
+    if (YYSTEPS > 0 && (YYSTEPS -= yygrant - yyleft) <= 0) YYSTEPS = -1;
+#endif
+#if YYSTATS
+    ++YYSTATSREC.parses;
+    if (yystatshook)
+        (*yystatshook)(yyn, (long) YYSTATSCLOCK() - yystart);
+#endif
+    return (yyn);
 }
@@ -1,5 +1,5 @@
 #ifndef lint
-static char yysccsid[] = "@(#)yaccpar	1.9 (Berkeley) 02/21/93";
+static char yysccsid[] = "@(#)yaccpar     1.9 (Berkeley) 02/21/93";
 #endif
 #define YYBYACC 1
 #define YYMAJOR 1
@@ -167,6 +167,28 @@ short yydgoto[] = {                                       1,
    34,   35,   71,   73,   75,   80,   84,   88,   45,   95,
   184,  125,  157,   96,
 };
+short yyerrdepth[] = {                                32767,
+    0,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+    1,    1,    1,    1,    1,    2,    2,    2,    2,    2,
+    2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
+    2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
+    2,    2,    2,    2,    2,    2,    2,    2,    2,    3,
+    3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+    3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+    3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+    3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+    3,    3,    3,    3,    3,    3,    4,    4,    4,    4,
+    4,    4,    4,    4,    4,    4,    4,    4,    4,    4,
+    4,    4,    4,    4,    4,    4,    4,    4,    4,    4,
+    4,    4,    4,    4,    4,    4,    4,    4,    4,    4,
+    4,    4,    5,    5,    5,    5,    5,    5,    5,    5,
+    5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+    5,    5,    5,    5,    5,    5,    5,    5,    5,    6,
+    6,    6,    6,    6,    6,    6,    7,    7,    7,    7,
+    8,    8,    8,    9,    9,   10,   11,   12,   13,
+};
 short yysindex[] = {                                      0,
  -224, -247, -239, -236, -232, -222, -204, -200, -181, -177,
     0,    0,    0, -166,    0, -161, -199,    0,    0,    0,
@@ -258,11 +280,106 @@ short yycheck[] = {                                      89,
   273,  270,  269,  273,  270,  273,  271,  270,  270,  273,
   271,   -1,   -1,  271,  273,  269,  273,  270,  270,  270,
 };
+#if YYEXPECTED
+#define YYEXPECTBYTES 40
+unsigned char yyexpect[][YYEXPECTBYTES] = {
+{1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,204,127,
+64,255,255,14,},
+{0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,204,127,
+64,255,255,14,},
+{0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,64,0,0,
+0,0,0,0,},
+{0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,32,0,0,
+0,0,0,0,},
+{0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,96,0,0,
+0,0,0,0,},
+{0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,},
+{0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,64,1,0,
+0,0,0,0,},
+{0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,2,0,
+0,0,0,0,},
+{0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,210,0,0,0,
+0,0,0,0,},
+{0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,32,6,0,0,
+0,0,0,0,},
+{0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,12,8,0,0,
+0,0,0,0,},
+{0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,2,112,},
+{0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,128,0,0,
+0,0,0,0,},
+{0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,96,2,0,
+0,0,0,0,},
+{0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8,17,0,0,
+0,0,0,0,},
+{0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,4,0,0,
+0,0,0,0,},
+};
+short yyexprow[] = {
+    0,    1,    2,    3,    3,    2,    3,    2,    3,    3,
+    3,    3,    3,    3,    3,    3,    3,    2,    3,    4,
+    4,    4,    3,    4,    4,    2,    3,    3,    2,    2,
+    3,    2,    3,    3,    0,    0,    0,    5,    6,    0,
+    7,    0,    8,    9,   10,    3,    3,    3,    7,    3,
+    5,    0,    3,    4,    4,    4,   11,    0,    3,    5,
+    0,    0,    3,    3,    2,    2,    3,    0,    3,    3,
+    2,    2,    2,    2,   12,    2,    4,    4,    2,   13,
+    2,    2,    2,    2,    2,    2,    2,    2,    2,    5,
+    5,    5,    4,    5,    2,    2,    2,    5,    5,    0,
+    5,    0,    5,    0,    4,    4,    4,    3,    5,    2,
+    5,    5,    0,    0,    5,    5,    5,    0,    0,    7,
+    0,   14,   14,    7,    2,    2,    0,    0,    0,    2,
+    2,    2,   15,    0,    2,    0,    2,    2,    2,    2,
+    5,    0,    4,    7,    0,    3,    2,    0,    2,    2,
+    2,    2,    2,   12,    2,    2,    2,    2,    2,    2,
+    0,    0,    0,    3,    0,    0,    0,    0,    0,    2,
+    7,    0,    2,    7,    0,    0,    0,    0,    0,    0,
+    7,    7,    0,    4,    2,    0,    3,   12,    2,    0,
+    5,    7,    0,    2,   12,    0,    7,   12,    7,    2,
+};
+#endif
 #define YYFINAL 1
+#define YYNSTATES 200
+#define YYNRULES 74
 #ifndef YYDEBUG
 #define YYDEBUG 0
 #endif
 #define YYMAXTOKEN 319
+#define YYNAME(i) yyname[i]
+#define YYRULE(i) yyrule[i]
 #if YYDEBUG
 char *yyname[] = {
 "end-of-file",0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -370,6 +487,75 @@ typedef int YYSTYPE;
 #endif
 #endif
 int yydebug;
+#if YYSTATS
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#ifndef YYSTATSCLOCK
+#define YYSTATSCLOCK() clock()
+#endif
+struct yystats
+{
+    long parses;
+    long shifts;
+    long recoveries;
+    long maxdepth;
+    long states;
+    long reductions[YYNRULES];
+};
+#endif
+#if YYPROFILE
+#include <stdio.h>
+#include <string.h>
+#endif
+#if YYTRACE
+#include <stdio.h>
+#ifndef YYTRACESIZE
+#define YYTRACESIZE 1024
+#endif
+#define YYTR_READ 1
+#define YYTR_SHIFT 2
+#define YYTR_REDUCE 3
+#define YYTR_GOTO 4
+#define YYTR_ERROR 5
+#define YYTR_RECOVER 6
+#define YYTR_POP 7
+#define YYTR_DISCARD 8
+#define YYTR_ACCEPT 9
+#define YYTR_ABORT 10
+struct yytrace
+{
+    unsigned char event;
+    short state;
+    short token;
+    short rule;
+};
+#endif
+#define yystacksize YYSTACKSIZE
+#if YYTOKENCLASSES
+#define YYCLASS(c) ((c) <= YYMAXTOKEN ? yytranslate[c] : 0)
+#else
+#define YYCLASS(c) (c)
+#define YYERRCLASS YYERRCODE
+#endif
+#if YYBUDGET
+#define YYEXHAUSTED 5
+#ifndef YYBUDGETINTERVAL
+#define YYBUDGETINTERVAL 1024
+#endif
+#ifndef YYCLOCK
+#include <time.h>
+static long
+yyclock()
+{
+    struct timespec yyt;
+
+    clock_gettime(CLOCK_MONOTONIC, &yyt);
+    return (yyt.tv_sec * 1000000000L + yyt.tv_nsec);
+}
+#define YYCLOCK() yyclock()
+#endif
+#endif
 int yynerrs;
 int yyerrflag;
 int yychar;
@@ -379,7 +565,206 @@ YYSTYPE yyval;
 YYSTYPE yylval;
 short yyss[YYSTACKSIZE];
 YYSTYPE yyvs[YYSTACKSIZE];
-#define yystacksize YYSTACKSIZE
+#define YYLEX yylex()
+#define YYERRORCALL(msg) yyerror(msg)
+#if YYBUDGET
+long yysteps;
+long yydeadline;
+#endif
+#if YYSTATS
+struct yystats yystats;
+#endif
+#define YYSTATSREC yystats
+#if YYTRACE
+struct yytrace yytracebuf[YYTRACESIZE];
+unsigned long yytracepos;
+#endif
+#define YYTRACEBUF yytracebuf
+#define YYTRACEPOS yytracepos
+#define YYTRACEADD(e, s, t, r) yytraceadd(e, s, t, r)
+#if YYPROFILE
+long yyprofstates[YYNSTATES];
+long yyproftokens[YYNSTATES][YYMAXTOKEN + 2];
+#endif
+#define YYPROFSTATES yyprofstates
+#define YYPROFTOKENS yyproftokens
+#if YYINCREMENTAL
+#error "YYINCREMENTAL requires --reentrant"
+#endif
+#if YYBUDGET
+#define YYSTEPS yysteps
+#define YYDEADLINE yydeadline
+#endif
+#if YYEXPECTED
+#define YYEXPECTS(state, token) \
+        (yyexpect[yyexprow[state]][(token) >> 3] >> ((token) & 7) & 1)
+int
+yyexpected(state, tokens, max)
+int state;
+int *tokens;
+int max;
+{
+    register unsigned char *yyb;
+    register int yyi, yyn;
+
+    yyb = yyexpect[yyexprow[state]];
+    yyn = 0;
+    for (yyi = 0; yyi < YYEXPECTBYTES * 8; ++yyi)
+    {
+        if (yyb[yyi >> 3] == 0)
+            yyi |= 7;
+        else if (yyb[yyi >> 3] >> (yyi & 7) & 1)
+        {
+            if (yyn < max) tokens[yyn] = yyi;
+            ++yyn;
+        }
+    }
+    return (yyn);
+}
+#endif
+#if YYPROFILE
+#ifndef YYCANONICAL
+#define YYCANONICAL(s) (s)
+#endif
+int
+yyprofdump(fp)
+FILE *fp;
+{
+    register int i, j;
+
+    fprintf(fp, "states %d\n", YYNSTATES);
+    for (i = 0; i < YYNSTATES; ++i)
+    {
+        if (YYPROFSTATES[i])
+            fprintf(fp, "s %d %ld\n", YYCANONICAL(i), YYPROFSTATES[i]);
+        for (j = 0; j <= YYMAXTOKEN + 1; ++j)
+            if (YYPROFTOKENS[i][j])
+                fprintf(fp, "t %d %d %ld\n", YYCANONICAL(i), j,
+                        YYPROFTOKENS[i][j]);
+    }
+    return (ferror(fp) ? -1 : 0);
+}
+#endif
+#if YYSTATS
+void (*yystatshook)();
+int
+yystatsdump(fp)
+FILE *fp;
+{
+    register int i;
+
+    fprintf(fp, "parses %ld\nshifts %ld\nrecoveries %ld\n",
+            YYSTATSREC.parses, YYSTATSREC.shifts, YYSTATSREC.recoveries);
+    fprintf(fp, "maxdepth %ld\nstates %ld\n",
+            YYSTATSREC.maxdepth, YYSTATSREC.states);
+    for (i = 0; i < YYNRULES; ++i)
+        if (YYSTATSREC.reductions[i])
+#if YYDEBUG
+            fprintf(fp, "rule %d %ld %s\n", i, YYSTATSREC.reductions[i],
+                    YYRULE(i));
+#else
+            fprintf(fp, "rule %d %ld\n", i, YYSTATSREC.reductions[i]);
+#endif
+    return (ferror(fp) ? -1 : 0);
+}
+#endif
+#if YYTRACE
+static void
+yytraceadd(event, state, token, rule)
+int event, state, token, rule;
+{
+    register struct yytrace *yyt;
+
+    yyt = &YYTRACEBUF[YYTRACEPOS++ % YYTRACESIZE];
+    yyt->event = event;
+    yyt->state = state;
+    yyt->token = token <= YYMAXTOKEN ? token : YYMAXTOKEN + 1;
+    yyt->rule = rule;
+}
+int
+yytracedump(fp)
+FILE *fp;
+{
+    register unsigned long i;
+    register struct yytrace *yyt;
+
+    i = YYTRACEPOS > YYTRACESIZE ? YYTRACEPOS - YYTRACESIZE : 0;
+    for (; i < YYTRACEPOS; ++i)
+    {
+        yyt = &YYTRACEBUF[i % YYTRACESIZE];
+        putc(yyt->event, fp);
+        putc(0, fp);
+        putc(yyt->state & 0xff, fp);
+        putc((yyt->state >> 8) & 0xff, fp);
+        putc(yyt->token & 0xff, fp);
+        putc((yyt->token >> 8) & 0xff, fp);
+        putc(yyt->rule & 0xff, fp);
+        putc((yyt->rule >> 8) & 0xff, fp);
+    }
+    return (ferror(fp) ? -1 : 0);
+}
+#if YYDEBUG
+int
+yytracedecode(in, out)
+FILE *in, *out;
+{
+    unsigned char r[8];
+    register int state, token, rule;
+    register char *s;
+
+    while (fread((char *) r, 1, 8, in) == 8)
+    {
+        state = (short) (r[2] | r[3] << 8);
+        token = (short) (r[4] | r[5] << 8);
+        rule = (short) (r[6] | r[7] << 8);
+        s = 0;
+        if (token >= 0 && token <= YYMAXTOKEN) s = YYNAME(token);
+        if (!s) s = "illegal-symbol";
+        switch (r[0])
+        {
+        case YYTR_READ:
+            fprintf(out, "state %d, reading %d (%s)\n", state, token, s);
+            break;
+        case YYTR_SHIFT:
+            fprintf(out, "shifting %d (%s) to state %d\n", token, s,
+                    state);
+            break;
+        case YYTR_REDUCE:
+            fprintf(out, "state %d, reducing by rule %d (%s)\n", state,
+                    rule, rule >= 0 && rule < YYNRULES ? YYRULE(rule) : "?");
+            break;
+        case YYTR_GOTO:
+            fprintf(out, "after reduction, going to state %d\n", state);
+            break;
+        case YYTR_ERROR:
+            fprintf(out, "state %d, syntax error at %d (%s)\n", state,
+                    token, s);
+            break;
+        case YYTR_RECOVER:
+            fprintf(out, "error recovery shifting to state %d\n", state);
+            break;
+        case YYTR_POP:
+            fprintf(out, "error recovery discarding state %d\n", state);
+            break;
+        case YYTR_DISCARD:
+            fprintf(out, "state %d, error recovery discards token %d (%s)\n",
+                    state, token, s);
+            break;
+        case YYTR_ACCEPT:
+            fprintf(out, "accept\n");
+            break;
+        case YYTR_ABORT:
+            fprintf(out, "abort in state %d\n", state);
+            break;
+        default:
+            fprintf(out, "unknown event %d\n", r[0]);
+            break;
+        }
+    }
+    return (ferror(out) ? -1 : 0);
+}
+#endif
+#endif
 #line 658 "ftp.y"
 
 extern jmp_buf errcatch;
@@ -904,7 +1289,7 @@ char *filename;
 		reply(504, "SIZE not implemented for Type %c.", "?AEIL"[type]);
 	}
 }
-#line 908 "ftp.tab.c"
+#line 1293 "ftp.tab.c"
 #define YYABORT goto yyabort
 #define YYREJECT goto yyabort
 #define YYACCEPT goto yyaccept
@@ -913,6 +1298,12 @@ int
 yyparse()
 {
     register int yym, yyn, yystate;
+#if YYSTATS
+    long yystart;
+#endif
+#if YYBUDGET
+    long yyleft, yygrant;
+#endif
 #if YYDEBUG
     register char *yys;
     extern char *getenv();
@@ -924,6 +1315,11 @@ yyparse()
             yydebug = yyn - '0';
     }
 #endif
+#if YYBUDGET
+    yygrant = YYDEADLINE ? YYBUDGETINTERVAL : 0x7fffffffL;
+    if (YYSTEPS && YYSTEPS < yygrant) yygrant = YYSTEPS < 0 ? 0 : YYSTEPS;
+    yyleft = yygrant;
+#endif
 
     yynerrs = 0;
     yyerrflag = 0;
@@ -932,53 +1328,123 @@ yyparse()
     yyssp = yyss;
     yyvsp = yyvs;
     *yyssp = yystate = 0;
+#if YYSTATS
+    yystart = yystatshook ? (long) YYSTATSCLOCK() : 0;
+#endif
 
 yyloop:
-    if (yyn = yydefred[yystate]) goto yyreduce;
+#if YYBUDGET
+    if (--yyleft < 0)
+    {
+        if (YYSTEPS > 0 && (YYSTEPS -= yygrant) <= 0) YYSTEPS = -1;
+        yygrant = yyleft = 0;
+        if (YYSTEPS < 0 || YYDEADLINE && YYCLOCK() >= YYDEADLINE)
+            goto yyexhausted;
+        yygrant = YYDEADLINE ? YYBUDGETINTERVAL : 0x7fffffffL;
+        if (YYSTEPS > 0 && YYSTEPS < yygrant) yygrant = YYSTEPS;
+        yyleft = yygrant - 1;
+    }
+#endif
+#if YYPROFILE
+    ++YYPROFSTATES[yystate];
+#endif
+#if YYSTATS
+    ++YYSTATSREC.states;
+    if (yyssp - yyss >= YYSTATSREC.maxdepth)
+        YYSTATSREC.maxdepth = yyssp - yyss + 1;
+#endif
+#if YYINTERLEAVED
+    if ((yyn = yystaterecs[yystate].defred) > 0) goto yyreduce;
+#else
+    if ((yyn = yydefred[yystate]) > 0) goto yyreduce;
+#endif
     if (yychar < 0)
     {
-        if ((yychar = yylex()) < 0) yychar = 0;
+        if ((yychar = YYLEX) < 0)
+        {
+            yychar = 0;
+        }
+#if YYINTERLEAVED
+        if (yychar > YYMAXTOKEN) yychar = YYMAXTOKEN + 1;
+#endif
 #if YYDEBUG
         if (yydebug)
         {
             yys = 0;
-            if (yychar <= YYMAXTOKEN) yys = yyname[yychar];
+            if (yychar <= YYMAXTOKEN) yys = YYNAME(yychar);
             if (!yys) yys = "illegal-symbol";
             printf("%sdebug: state %d, reading %d (%s)\n",
                     YYPREFIX, yystate, yychar, yys);
         }
+#endif
+#if YYTRACE
+        YYTRACEADD(YYTR_READ, yystate, yychar, -1);
 #endif
     }
-    if ((yyn = yysindex[yystate]) && (yyn += yychar) >= 0 &&
-            yyn <= YYTABLESIZE && yycheck[yyn] == yychar)
+#if YYPROFILE
+    ++YYPROFTOKENS[yystate][yychar <= YYMAXTOKEN ? yychar : YYMAXTOKEN + 1];
+#endif
+#if YYINTERLEAVED
+    if ((yyn = yystaterecs[yystate].sindex) &&
+            yypairs[yyn += YYCLASS(yychar)].check == YYCLASS(yychar))
+    {
+        yyn = yypairs[yyn].value;
+#else
+    if ((yyn = yysindex[yystate]) && (yyn += YYCLASS(yychar)) >= 0 &&
+            yyn <= YYTABLESIZE && yycheck[yyn] == YYCLASS(yychar))
     {
+        yyn = yytable[yyn];
+#endif
 #if YYDEBUG
         if (yydebug)
             printf("%sdebug: state %d, shifting to state %d\n",
-                    YYPREFIX, yystate, yytable[yyn]);
+                    YYPREFIX, yystate, yyn);
 #endif
         if (yyssp >= yyss + yystacksize - 1)
         {
             goto yyoverflow;
         }
-        *++yyssp = yystate = yytable[yyn];
+        *++yyssp = yystate = yyn;
         *++yyvsp = yylval;
+#if YYSTATS
+        ++YYSTATSREC.shifts;
+#endif
+#if YYTRACE
+        YYTRACEADD(YYTR_SHIFT, yystate, yychar, -1);
+#endif
         yychar = (-1);
         if (yyerrflag > 0)  --yyerrflag;
         goto yyloop;
     }
-    if ((yyn = yyrindex[yystate]) && (yyn += yychar) >= 0 &&
-            yyn <= YYTABLESIZE && yycheck[yyn] == yychar)
+#if YYINTERLEAVED
+    if ((yyn = yystaterecs[yystate].rindex) &&
+            yypairs[yyn += YYCLASS(yychar)].check == YYCLASS(yychar))
+    {
+        yyn = yypairs[yyn].value;
+        goto yyreduce;
+    }
+#else
+    if ((yyn = yyrindex[yystate]) && (yyn += YYCLASS(yychar)) >= 0 &&
+            yyn <= YYTABLESIZE && yycheck[yyn] == YYCLASS(yychar))
     {
         yyn = yytable[yyn];
         goto yyreduce;
     }
+#endif
+#if YYINTERLEAVED
+    if ((yyn = -yystaterecs[yystate].defred) > 0) goto yyreduce;
+#else
+    if ((yyn = -yydefred[yystate]) > 0) goto yyreduce;
+#endif
     if (yyerrflag) goto yyinrecovery;
 #ifdef lint
     goto yynewerror;
 #endif
 yynewerror:
-    yyerror("syntax error");
+#if YYTRACE
+    YYTRACEADD(YYTR_ERROR, yystate, yychar, -1);
+#endif
+    YYERRORCALL("syntax error");
 #ifdef lint
     goto yyerrlab;
 #endif
@@ -990,32 +1456,56 @@ yyinrecovery:
         yyerrflag = 3;
         for (;;)
         {
-            if ((yyn = yysindex[*yyssp]) && (yyn += YYERRCODE) >= 0 &&
-                    yyn <= YYTABLESIZE && yycheck[yyn] == YYERRCODE)
+#if YYINTERLEAVED
+            if ((yyn = yystaterecs[*yyssp].sindex) &&
+                    yypairs[yyn += YYERRCLASS].check == YYERRCLASS)
             {
+                yyn = yypairs[yyn].value;
+#else
+            if ((yyn = yysindex[*yyssp]) && (yyn += YYERRCLASS) >= 0 &&
+                    yyn <= YYTABLESIZE && yycheck[yyn] == YYERRCLASS)
+            {
+                yyn = yytable[yyn];
+#endif
 #if YYDEBUG
                 if (yydebug)
                     printf("%sdebug: state %d, error recovery shifting\
- to state %d\n", YYPREFIX, *yyssp, yytable[yyn]);
+ to state %d\n", YYPREFIX, *yyssp, yyn);
+#endif
+#if YYSTATS
+                ++YYSTATSREC.recoveries;
+#endif
+#if YYTRACE
+                YYTRACEADD(YYTR_RECOVER, yyn, YYERRCODE, -1);
 #endif
                 if (yyssp >= yyss + yystacksize - 1)
                 {
                     goto yyoverflow;
                 }
-                *++yyssp = yystate = yytable[yyn];
+                *++yyssp = yystate = yyn;
                 *++yyvsp = yylval;
                 goto yyloop;
             }
             else
             {
+                yym = yyerrdepth[*yyssp];
+#if YYDEBUG || YYTRACE
+                for (yyn = 0; yyn < yym; ++yyn)
+                {
 #if YYDEBUG
-                if (yydebug)
-                    printf("%sdebug: error recovery discarding state %d\n",
-                            YYPREFIX, *yyssp);
+                    if (yydebug)
+                        printf("%sdebug: error recovery discarding state\
+ %d\n", YYPREFIX, yyssp[-yyn]);
+#endif
+#if YYTRACE
+                    YYTRACEADD(YYTR_POP, yyssp[-yyn], -1, -1);
+#endif
+                    if (yyssp - yyn <= yyss) goto yyabort;
+                }
 #endif
-                if (yyssp <= yyss) goto yyabort;
-                --yyssp;
-                --yyvsp;
+                if (yym > yyssp - yyss) goto yyabort;
+                yyssp -= yym;
+                yyvsp -= yym;
             }
         }
     }
@@ -1026,32 +1516,42 @@ yyinrecovery:
         if (yydebug)
         {
             yys = 0;
-            if (yychar <= YYMAXTOKEN) yys = yyname[yychar];
+            if (yychar <= YYMAXTOKEN) yys = YYNAME(yychar);
             if (!yys) yys = "illegal-symbol";
             printf("%sdebug: state %d, error recovery discards token %d (%s)\n",
                     YYPREFIX, yystate, yychar, yys);
         }
+#endif
+#if YYTRACE
+        YYTRACEADD(YYTR_DISCARD, yystate, yychar, -1);
 #endif
         yychar = (-1);
         goto yyloop;
     }
 yyreduce:
+#if YYSTATS
+    ++YYSTATSREC.reductions[yyn];
+#endif
+#if YYTRACE
+    YYTRACEADD(YYTR_REDUCE, yystate, -1, yyn);
+#endif
 #if YYDEBUG
     if (yydebug)
         printf("%sdebug: state %d, reducing by rule %d (%s)\n",
-                YYPREFIX, yystate, yyn, yyrule[yyn]);
+                YYPREFIX, yystate, yyn, YYRULE(yyn));
 #endif
     yym = yylen[yyn];
-    yyval = yyvsp[1-yym];
     switch (yyn)
     {
 case 2:
+yyval = yyvsp[1-yym];
 #line 99 "ftp.y"
  {
 			fromname = (char *) 0;
 		}
 break;
 case 4:
+yyval = yyvsp[1-yym];
 #line 106 "ftp.y"
  {
 			user((char *) yyvsp[-1]);
@@ -1059,6 +1559,7 @@ case 4:
 		}
 break;
 case 5:
+yyval = yyvsp[1-yym];
 #line 111 "ftp.y"
  {
 			pass((char *) yyvsp[-1]);
@@ -1066,6 +1567,7 @@ case 5:
 		}
 break;
 case 6:
+yyval = yyvsp[1-yym];
 #line 116 "ftp.y"
  {
 			usedefault = 0;
@@ -1077,12 +1579,14 @@ case 6:
 		}
 break;
 case 7:
+yyval = yyvsp[1-yym];
 #line 125 "ftp.y"
  {
 			passive();
 		}
 break;
 case 8:
+yyval = yyvsp[1-yym];
 #line 129 "ftp.y"
  {
 			switch (cmd_type) {
@@ -1120,6 +1624,7 @@ case 8:
 		}
 break;
 case 9:
+yyval = yyvsp[1-yym];
 #line 164 "ftp.y"
  {
 			switch (yyvsp[-1]) {
@@ -1134,6 +1639,7 @@ case 9:
 		}
 break;
 case 10:
+yyval = yyvsp[1-yym];
 #line 176 "ftp.y"
  {
 			switch (yyvsp[-1]) {
@@ -1148,18 +1654,21 @@ case 10:
 		}
 break;
 case 11:
+yyval = yyvsp[1-yym];
 #line 188 "ftp.y"
  {
 			reply(202, "ALLO command ignored.");
 		}
 break;
 case 12:
+yyval = yyvsp[1-yym];
 #line 192 "ftp.y"
  {
 			reply(202, "ALLO command ignored.");
 		}
 break;
 case 13:
+yyval = yyvsp[1-yym];
 #line 196 "ftp.y"
  {
 			if (yyvsp[-3] && yyvsp[-1] != NULL)
@@ -1169,6 +1678,7 @@ case 13:
 		}
 break;
 case 14:
+yyval = yyvsp[1-yym];
 #line 203 "ftp.y"
  {
 			if (yyvsp[-3] && yyvsp[-1] != NULL)
@@ -1178,6 +1688,7 @@ case 14:
 		}
 break;
 case 15:
+yyval = yyvsp[1-yym];
 #line 210 "ftp.y"
  {
 			if (yyvsp[-3] && yyvsp[-1] != NULL)
@@ -1187,6 +1698,7 @@ case 15:
 		}
 break;
 case 16:
+yyval = yyvsp[1-yym];
 #line 217 "ftp.y"
  {
 			if (yyvsp[-1])
@@ -1194,6 +1706,7 @@ case 16:
 		}
 break;
 case 17:
+yyval = yyvsp[1-yym];
 #line 222 "ftp.y"
  {
 			if (yyvsp[-3] && yyvsp[-1] != NULL) 
@@ -1203,6 +1716,7 @@ case 17:
 		}
 break;
 case 18:
+yyval = yyvsp[1-yym];
 #line 229 "ftp.y"
  {
 			if (yyvsp[-1])
@@ -1210,6 +1724,7 @@ case 18:
 		}
 break;
 case 19:
+yyval = yyvsp[1-yym];
 #line 234 "ftp.y"
  {
 			if (yyvsp[-3] && yyvsp[-1] != NULL)
@@ -1219,6 +1734,7 @@ case 19:
 		}
 break;
 case 20:
+yyval = yyvsp[1-yym];
 #line 241 "ftp.y"
  {
 			if (yyvsp[-3] && yyvsp[-1] != NULL)
@@ -1228,12 +1744,14 @@ case 20:
 		}
 break;
 case 21:
+yyval = yyvsp[1-yym];
 #line 248 "ftp.y"
  {
 			statcmd();
 		}
 break;
 case 22:
+yyval = yyvsp[1-yym];
 #line 252 "ftp.y"
  {
 			if (yyvsp[-3] && yyvsp[-1] != NULL)
@@ -1243,6 +1761,7 @@ case 22:
 		}
 break;
 case 23:
+yyval = yyvsp[1-yym];
 #line 259 "ftp.y"
  {
 			if (fromname) {
@@ -1256,12 +1775,14 @@ case 23:
 		}
 break;
 case 24:
+yyval = yyvsp[1-yym];
 #line 270 "ftp.y"
  {
 			reply(225, "ABOR command successful.");
 		}
 break;
 case 25:
+yyval = yyvsp[1-yym];
 #line 274 "ftp.y"
  {
 			if (yyvsp[-1])
@@ -1269,6 +1790,7 @@ case 25:
 		}
 break;
 case 26:
+yyval = yyvsp[1-yym];
 #line 279 "ftp.y"
  {
 			if (yyvsp[-3] && yyvsp[-1] != NULL)
@@ -1278,12 +1800,14 @@ case 26:
 		}
 break;
 case 27:
+yyval = yyvsp[1-yym];
 #line 286 "ftp.y"
  {
 			help(cmdtab, (char *) 0);
 		}
 break;
 case 28:
+yyval = yyvsp[1-yym];
 #line 290 "ftp.y"
  {
 			register char *cp = (char *)yyvsp[-1];
@@ -1301,12 +1825,14 @@ case 28:
 		}
 break;
 case 29:
+yyval = yyvsp[1-yym];
 #line 305 "ftp.y"
  {
 			reply(200, "NOOP command successful.");
 		}
 break;
 case 30:
+yyval = yyvsp[1-yym];
 #line 309 "ftp.y"
  {
 			if (yyvsp[-3] && yyvsp[-1] != NULL)
@@ -1316,6 +1842,7 @@ case 30:
 		}
 break;
 case 31:
+yyval = yyvsp[1-yym];
 #line 316 "ftp.y"
  {
 			if (yyvsp[-3] && yyvsp[-1] != NULL)
@@ -1325,6 +1852,7 @@ case 31:
 		}
 break;
 case 32:
+yyval = yyvsp[1-yym];
 #line 323 "ftp.y"
  {
 			if (yyvsp[-1])
@@ -1332,6 +1860,7 @@ case 32:
 		}
 break;
 case 33:
+yyval = yyvsp[1-yym];
 #line 328 "ftp.y"
  {
 			if (yyvsp[-1])
@@ -1339,18 +1868,21 @@ case 33:
 		}
 break;
 case 34:
+yyval = yyvsp[1-yym];
 #line 333 "ftp.y"
  {
 			help(sitetab, (char *) 0);
 		}
 break;
 case 35:
+yyval = yyvsp[1-yym];
 #line 337 "ftp.y"
  {
 			help(sitetab, (char *) yyvsp[-1]);
 		}
 break;
 case 36:
+yyval = yyvsp[1-yym];
 #line 341 "ftp.y"
  {
 			int oldmask;
@@ -1363,6 +1895,7 @@ case 36:
 		}
 break;
 case 37:
+yyval = yyvsp[1-yym];
 #line 351 "ftp.y"
  {
 			int oldmask;
@@ -1380,6 +1913,7 @@ case 37:
 		}
 break;
 case 38:
+yyval = yyvsp[1-yym];
 #line 366 "ftp.y"
  {
 			if (yyvsp[-5] && (yyvsp[-1] != NULL)) {
@@ -1396,6 +1930,7 @@ case 38:
 		}
 break;
 case 39:
+yyval = yyvsp[1-yym];
 #line 380 "ftp.y"
  {
 			reply(200,
@@ -1404,6 +1939,7 @@ case 39:
 		}
 break;
 case 40:
+yyval = yyvsp[1-yym];
 #line 386 "ftp.y"
  {
 			if (yyvsp[-1] < 30 || yyvsp[-1] > maxtimeout) {
@@ -1420,6 +1956,7 @@ case 40:
 		}
 break;
 case 41:
+yyval = yyvsp[1-yym];
 #line 400 "ftp.y"
  {
 			if (yyvsp[-3] && yyvsp[-1] != NULL)
@@ -1429,6 +1966,7 @@ case 41:
 		}
 break;
 case 42:
+yyval = yyvsp[1-yym];
 #line 407 "ftp.y"
  {
 #ifdef unix
@@ -1444,6 +1982,7 @@ case 42:
 		}
 break;
 case 43:
+yyval = yyvsp[1-yym];
 #line 428 "ftp.y"
  {
 			if (yyvsp[-3] && yyvsp[-1] != NULL)
@@ -1453,6 +1992,7 @@ case 43:
 		}
 break;
 case 44:
+yyval = yyvsp[1-yym];
 #line 445 "ftp.y"
  {
 			if (yyvsp[-3] && yyvsp[-1] != NULL) {
@@ -1477,6 +2017,7 @@ case 44:
 		}
 break;
 case 45:
+yyval = yyvsp[1-yym];
 #line 467 "ftp.y"
  {
 			reply(221, "Goodbye.");
@@ -1484,12 +2025,14 @@ case 45:
 		}
 break;
 case 46:
+yyval = yyvsp[1-yym];
 #line 472 "ftp.y"
  {
 			yyerrok;
 		}
 break;
 case 47:
+yyval = yyvsp[1-yym];
 #line 477 "ftp.y"
  {
 			char *renamefrom();
@@ -1509,6 +2052,7 @@ case 49:
 		}
 break;
 case 52:
+yyval = yyvsp[1-yym];
 #line 504 "ftp.y"
  {
 			register char *a, *p;
@@ -1539,6 +2083,7 @@ case 55:
 	}
 break;
 case 56:
+yyval = yyvsp[1-yym];
 #line 530 "ftp.y"
  {
 		cmd_type = TYPE_A;
@@ -1546,6 +2091,7 @@ case 56:
 	}
 break;
 case 57:
+yyval = yyvsp[1-yym];
 #line 535 "ftp.y"
  {
 		cmd_type = TYPE_A;
@@ -1553,6 +2099,7 @@ case 57:
 	}
 break;
 case 58:
+yyval = yyvsp[1-yym];
 #line 540 "ftp.y"
  {
 		cmd_type = TYPE_E;
@@ -1560,6 +2107,7 @@ case 58:
 	}
 break;
 case 59:
+yyval = yyvsp[1-yym];
 #line 545 "ftp.y"
  {
 		cmd_type = TYPE_E;
@@ -1567,12 +2115,14 @@ case 59:
 	}
 break;
 case 60:
+yyval = yyvsp[1-yym];
 #line 550 "ftp.y"
  {
 		cmd_type = TYPE_I;
 	}
 break;
 case 61:
+yyval = yyvsp[1-yym];
 #line 554 "ftp.y"
  {
 		cmd_type = TYPE_L;
@@ -1580,6 +2130,7 @@ case 61:
 	}
 break;
 case 62:
+yyval = yyvsp[1-yym];
 #line 559 "ftp.y"
  {
 		cmd_type = TYPE_L;
@@ -1587,6 +2138,7 @@ case 62:
 	}
 break;
 case 63:
+yyval = yyvsp[1-yym];
 #line 565 "ftp.y"
  {
 		cmd_type = TYPE_L;
@@ -1630,6 +2182,7 @@ case 69:
 	}
 break;
 case 70:
+yyval = yyvsp[1-yym];
 #line 600 "ftp.y"
  {
 		/*
@@ -1649,6 +2202,7 @@ case 70:
 	}
 break;
 case 72:
+yyval = yyvsp[1-yym];
 #line 622 "ftp.y"
  {
 		register int ret, dec, multby, digit;
@@ -1684,7 +2238,12 @@ case 73:
 		}
 	}
 break;
-#line 1688 "ftp.tab.c"
+#line 2242 "ftp.tab.c"
+    case 1:
+        break;
+    default:
+        yyval = yyvsp[1-yym];
+        break;
     }
     yyssp -= yym;
     yystate = *yyssp;
@@ -1696,36 +2255,56 @@ break;
         if (yydebug)
             printf("%sdebug: after reduction, shifting from state 0 to\
  state %d\n", YYPREFIX, YYFINAL);
+#endif
+#if YYTRACE
+        YYTRACEADD(YYTR_GOTO, YYFINAL, -1, -1);
 #endif
         yystate = YYFINAL;
         *++yyssp = YYFINAL;
         *++yyvsp = yyval;
         if (yychar < 0)
         {
-            if ((yychar = yylex()) < 0) yychar = 0;
+            if ((yychar = YYLEX) < 0)
+            {
+                yychar = 0;
+            }
+#if YYINTERLEAVED
+            if (yychar > YYMAXTOKEN) yychar = YYMAXTOKEN + 1;
+#endif
 #if YYDEBUG
             if (yydebug)
             {
                 yys = 0;
-                if (yychar <= YYMAXTOKEN) yys = yyname[yychar];
+                if (yychar <= YYMAXTOKEN) yys = YYNAME(yychar);
                 if (!yys) yys = "illegal-symbol";
                 printf("%sdebug: state %d, reading %d (%s)\n",
                         YYPREFIX, YYFINAL, yychar, yys);
             }
+#endif
+#if YYTRACE
+            YYTRACEADD(YYTR_READ, YYFINAL, yychar, -1);
 #endif
         }
         if (yychar == 0) goto yyaccept;
         goto yyloop;
     }
+#if YYINTERLEAVED
+    if ((yyn = yygindex[yym]) && yypairs[yyn += yystate].check == yystate)
+        yystate = yypairs[yyn].value;
+#else
     if ((yyn = yygindex[yym]) && (yyn += yystate) >= 0 &&
             yyn <= YYTABLESIZE && yycheck[yyn] == yystate)
         yystate = yytable[yyn];
+#endif
     else
         yystate = yydgoto[yym];
 #if YYDEBUG
     if (yydebug)
         printf("%sdebug: after reduction, shifting from state %d \
 to state %d\n", YYPREFIX, *yyssp, yystate);
+#endif
+#if YYTRACE
+    YYTRACEADD(YYTR_GOTO, yystate, -1, -1);
 #endif
     if (yyssp >= yyss + yystacksize - 1)
     {
@@ -1735,9 +2314,31 @@ to state %d\n", YYPREFIX, *yyssp, yystate);
     *++yyvsp = yyval;
     goto yyloop;
 yyoverflow:
-    yyerror("yacc stack overflow");
+    YYERRORCALL("yacc stack overflow");
 yyabort:
-    return (1);
+#if YYTRACE
+    YYTRACEADD(YYTR_ABORT, *yyssp, yychar, -1);
+#endif
+    yyn = 1;
+    goto yyreturn;
 yyaccept:
-    return (0);
+#if YYTRACE
+    YYTRACEADD(YYTR_ACCEPT, YYFINAL, 0, -1);
+#endif
+    yyn = 0;
+#if YYBUDGET
+    goto yyreturn;
+yyexhausted:
+    yyn = YYEXHAUSTED;
+#endif
+yyreturn:
+#if YYBUDGET
+    if (YYSTEPS > 0 && (YYSTEPS -= yygrant - yyleft) <= 0) YYSTEPS = -1;
+#endif
+#if YYSTATS
+    ++YYSTATSREC.parses;
+    if (yystatshook)
+        (*yystatshook)(yyn, (long) YYSTATSCLOCK() - yystart);
+#endif
+    return (yyn);
 }
@@ -0,0 +1,74 @@
+/*
+ * Test of --merge-actions on rules that share an action but not the
+ * default value of $$.
+ *
+ * The rules of opt, opt2 and pair have the same action, but opt is empty
+ * and has no $1 to copy into $$, while opt2 and pair pass the value of
+ * their first token up as their own value.  Merging opt with the others
+ * would lose that value, and with --action-functions, where $1 is found
+ * at a fixed depth, so would merging opt2 with pair.
+ *
+ * Build it with "make check", which generates the parser with and
+ * without --merge-actions and --action-functions; every variant must
+ * print "ok" and exit with status 0.
+ */
+
+%{
+#include <stdio.h>
+#include <stdlib.h>
+
+int	count;
+%}
+
+%token X
+
+%%
+
+top	:	opt opt2 pair
+		    {
+			if ($2 != 42 || $3 != 7 || count != 3)
+			{
+			    printf("failed: $2 = %d, $3 = %d, count = %d\n",
+				    $2, $3, count);
+			    exit(1);
+			}
+			printf("ok\n");
+		    }
+	;
+
+opt	:	/* empty */
+		    { count++; }
+	;
+
+opt2	:	X
+		    { count++; }
+	;
+
+pair	:	X X
+		    { count++; }
+	;
+
+%%
+
+static int tokens[] = { X, X, X, 0 };
+static int values[] = { 42, 7, 9, 0 };
+static int next;
+
+int
+yylex()
+{
+    yylval = values[next];
+    return (tokens[next++]);
+}
+
+yyerror(s)
+char *s;
+{
+    printf("%s\n", s);
+    exit(1);
+}
+
+main()
+{
+    return (yyparse());
+}
@@ -3,6 +3,9 @@
 
 
 static short *null_rules;
+static short *goto_first;
+static short *goto_next;
+static short *goto_symbol;
 
 verbose()
 {
@@ -13,18 +16,33 @@ verbose()
     null_rules = (short *) MALLOC(nrules*sizeof(short));
     if (null_rules == 0) no_space();
     fprintf(verbose_file, "\f\n");
+    link_state_gotos();
     for (i = 0; i < nstates; i++)
         print_state(i);
     FREE(null_rules);
+    FREE(goto_first);
+    FREE(goto_next);
+    FREE(goto_symbol);
 
     if (nunused)
         log_unused();
     if (SRtotal || RRtotal)
         log_conflicts();
+    log_sync_tokens();
 
     fprintf(verbose_file, "\n\n%d terminals, %d nonterminals\n", ntokens,
             nvars);
     fprintf(verbose_file, "%d grammar rules, %d states\n", nrules - 2, nstates);
+    if (tcflag)
+        fprintf(verbose_file, "%d token classes\n", nclasses);
+    if (urflag)
+        fprintf(verbose_file, "%d unit rules bypassed\n", nbypassed);
+    if (mcflag)
+        fprintf(verbose_file, "%d default reductions made on lookahead, \
+replacing %d table entries\n", nlatereds, nlateentries);
+    if (nmerged || nunreachable)
+        fprintf(verbose_file, "%d states merged, %d unreachable states removed\n",
+                nmerged, nunreachable);
 }
 
 
@@ -47,6 +65,24 @@ log_unused()
 }
 
 
+log_sync_tokens()
+{
+    register int i, n;
+
+    n = 0;
+    for (i = 2; i < ntokens; ++i)
+    {
+        if (sync_token[i])
+        {
+            if (n++ == 0)
+                fprintf(verbose_file, "\n\nRestart-safe tokens:");
+            fprintf(verbose_file, " %s", symbol_name[i]);
+        }
+    }
+    if (n) fprintf(verbose_file, "\n");
+}
+
+
 log_conflicts()
 {
     register int i;
@@ -147,28 +183,29 @@ int state;
     register short *sp;
     register short *sp1;
 
-    statep = state_table[state];
-    k = statep->nitems;
-
-    for (i = 0; i < k; i++)
+    for (statep = state_table[state]; statep; statep = statep->merged)
     {
-        sp1 = sp = ritem + statep->items[i];
+        k = statep->nitems;
+        for (i = 0; i < k; i++)
+        {
+            sp1 = sp = ritem + statep->items[i];
 
-        while (*sp >= 0) ++sp;
-        rule = -(*sp);
-        fprintf(verbose_file, "\t%s : ", symbol_name[rlhs[rule]]);
+            while (*sp >= 0) ++sp;
+            rule = -(*sp);
+            fprintf(verbose_file, "\t%s : ", symbol_name[rlhs[rule]]);
 
-        for (sp = ritem + rrhs[rule]; sp < sp1; sp++)
-            fprintf(verbose_file, "%s ", symbol_name[*sp]);
+            for (sp = ritem + rrhs[rule]; sp < sp1; sp++)
+                fprintf(verbose_file, "%s ", symbol_name[*sp]);
 
-        putc('.', verbose_file);
+            putc('.', verbose_file);
 
-        while (*sp >= 0)
-        {
-            fprintf(verbose_file, " %s", symbol_name[*sp]);
-            sp++;
+            while (*sp >= 0)
+            {
+                fprintf(verbose_file, " %s", symbol_name[*sp]);
+                sp++;
+            }
+            fprintf(verbose_file, "  (%d)\n", -2 - *sp);
         }
-        fprintf(verbose_file, "  (%d)\n", -2 - *sp);
     }
 }
 
@@ -221,8 +258,6 @@ print_actions(stateno)
 int stateno;
 {
     register action *p;
-    register shifts *sp;
-    register int as;
 
     if (stateno == final_state)
         fprintf(verbose_file, "\t$end  accept\n");
@@ -234,13 +269,8 @@ int stateno;
         print_reductions(p, defred[stateno]);
     }
 
-    sp = shift_table[stateno];
-    if (sp && sp->nshifts > 0)
-    {
-        as = accessing_symbol[sp->shift[sp->nshifts - 1]];
-        if (ISVAR(as))
-            print_gotos(stateno);
-    }
+    if (goto_first[stateno] >= 0)
+        print_gotos(stateno);
 }
 
 
@@ -310,20 +340,35 @@ register int defred;
 print_gotos(stateno)
 int stateno;
 {
-    register int i, k;
-    register int as;
-    register short *to_state;
-    register shifts *sp;
+    register int k;
 
     putc('\n', verbose_file);
-    sp = shift_table[stateno];
-    to_state = sp->shift;
-    for (i = 0; i < sp->nshifts; ++i)
+    for (k = goto_first[stateno]; k >= 0; k = goto_next[k])
+        fprintf(verbose_file, "\t%s  goto %d\n", symbol_name[goto_symbol[k]],
+                to_state[k]);
+}
+
+
+/**
+*   @brief Lists the gotos of each state, in the order of their symbols, as the tables give them
+*/
+link_state_gotos()
+{
+    register int i, k;
+
+    goto_first = NEW2(nstates, short);
+    goto_next = NEW2(goto_map[nsyms], short);
+    goto_symbol = NEW2(goto_map[nsyms], short);
+    for (i = 0; i < nstates; ++i)
+        goto_first[i] = -1;
+
+    for (i = nsyms - 1; i >= ntokens; --i)
     {
-        k = to_state[i];
-        as = accessing_symbol[k];
-        if (ISVAR(as))
-            fprintf(verbose_file, "\t%s  goto %d\n", symbol_name[as], k);
+        for (k = goto_map[i + 1] - 1; k >= goto_map[i]; --k)
+        {
+            goto_symbol[k] = i;
+            goto_next[k] = goto_first[from_state[k]];
+            goto_first[from_state[k]] = k;
+        }
     }
 }
-